@@ -0,0 +1,83 @@
+/******************************************************************************************
+  Filename    : FastIsr.s
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Level 5 fast interrupt handler of the 1ms systick (see Irq_RegisterFast)
+
+******************************************************************************************/
+
+/*******************************************************************************************
+  \brief  1ms systick on the CPU timer 2 (CCOMPARE2, level 5), called from the vector
+          with a0 = return address, every other register is saved here
+
+  \param  void
+
+  \return void
+********************************************************************************************/
+.section  .iram.hot,"ax"
+.type systicktimer_1ms_fast, @function
+.align 4
+.extern SysTickTimer1msBase
+.extern IsrLatencyFastPath
+.global systicktimer_1ms_fast
+
+systicktimer_1ms_fast:
+                       addi   sp, sp, -16
+                       s32i.n a2, sp, 0
+                       s32i.n a3, sp, 4
+                       s32i.n a4, sp, 8
+                       s32i.n a5, sp, 12
+
+                       /* cycles elapsed since the CCOMPARE2 match */
+                       rsr    a2, ccount
+                       rsr    a3, ccompare2
+                       sub    a2, a2, a3
+
+                       /* keep the worst latency */
+                       movi   a4, IsrLatencyFastPath
+                       l32i   a5, a4, 0
+                       maxu   a5, a5, a2
+                       s32i   a5, a4, 0
+
+                       /* absolute reload CCOMPARE2 += 1ms (clears the interrupt), a deadline
+                          already behind CCOUNT restarts one period from now (the match would
+                          otherwise wait for a full CCOUNT wrap) */
+                       movi   a4, 80000
+                       add    a3, a3, a4
+                       rsr    a2, ccount
+                       sub    a5, a3, a2
+                       addi   a5, a5, -64
+                       bgez   a5, .L_reload
+                       add    a3, a2, a4
+.L_reload:
+                       wsr    a3, ccompare2
+                       esync
+
+                       /* 64-bit tick counter */
+                       movi   a4, SysTickTimer1msBase
+                       l32i   a2, a4, 0
+                       l32i   a3, a4, 4
+                       addi   a2, a2, 1
+                       bnez   a2, .L_no_carry
+                       addi   a3, a3, 1
+.L_no_carry:
+                       s32i   a2, a4, 0
+                       s32i   a3, a4, 4
+
+                       l32i.n a2, sp, 0
+                       l32i.n a3, sp, 4
+                       l32i.n a4, sp, 8
+                       l32i.n a5, sp, 12
+                       addi   sp, sp, 16
+                       ret
+
+.size systicktimer_1ms_fast, .-systicktimer_1ms_fast
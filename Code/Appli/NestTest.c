@@ -0,0 +1,168 @@
+/******************************************************************************************
+  Filename    : NestTest.c
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Interrupt nesting stress test (make NEST_TEST=1). A level 1 handler keeps
+                LBEG/LEND/LCOUNT, SAR, ACC, M0..M3 and a5..a15 live in a zero-overhead loop
+                while the level 3 CPU timer 1 (CCOMPARE1) preempts it again and again and
+                overwrites all of them, then checks that they survived the nested returns.
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "NestTest.h"
+#include "Irq.h"
+#include "printf.h"
+#include "core-isa.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* level 1 software interrupt running the body */
+#define NEST_TEST_LEVEL1_CPU_INT    7ul
+
+/* level 3 CPU timer 1 (CCOMPARE1), borrowed before its owner registers it */
+#define NEST_TEST_TIMER             1ul
+#define NEST_TEST_LEVEL3_CPU_INT    XCHAL_TIMER1_INTERRUPT
+
+#if (XCHAL_INT7_LEVEL != 1) || (XCHAL_INT15_LEVEL != 3)
+  #error "the nesting test needs the CPU interrupt 7 at level 1 and the CPU timer 1 at level 3"
+#endif
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define NEST_TEST_RAISE()           __asm__ volatile ("wsr.intset %0\n\trsync" : : "r"(1ul << NEST_TEST_LEVEL1_CPU_INT) : "memory")
+#define NEST_TEST_CLEAR()           __asm__ volatile ("wsr.intclear %0\n\trsync" : : "r"(1ul << NEST_TEST_LEVEL1_CPU_INT) : "memory")
+
+//=============================================================================
+// Externs
+//=============================================================================
+extern uint32 get_core_id(void);
+extern void set_cpu_private_timer(uint32 timer_id, uint32 ticks);
+extern uint32 NestTest_Body(uint32 Iterations);
+extern void NestTest_Clobber(void);
+
+//=============================================================================
+// Globals
+//=============================================================================
+static volatile uint32 NestTest_Errors;
+static volatile uint32 NestTest_Rounds;
+static volatile boolean NestTest_InBody;
+
+/* level 3 interrupts taken while the body ran */
+static volatile uint32 NestTest_BodyHits;
+
+//=============================================================================
+// Static functions
+//=============================================================================
+static void NestTest_Level1(void* Arg);
+static void NestTest_Level3(void* Arg);
+
+//-----------------------------------------------------------------------------------------
+/// \brief  NestTest_Run function
+///
+/// \descr  Runs the body NEST_TEST_ROUNDS times from the level 1 interrupt of the calling
+///         core (before Os_Start) and prints:
+///         NEST <rounds> <level 3 preemptions of the body> <error bits> <OK|FAIL>
+///         FAIL means a lost state (NEST_TEST_ERR_xxx) or a body never preempted.
+///
+/// \param  void
+///
+/// \return TRUE if every state survived
+//-----------------------------------------------------------------------------------------
+COLD_ATTR boolean NestTest_Run(void)
+{
+  const uint32 Core = get_core_id();
+  boolean Result;
+  uint32 Round;
+
+  NestTest_Errors   = 0ul;
+  NestTest_BodyHits = 0ul;
+
+  if((Irq_Register(Core, NEST_TEST_LEVEL1_CPU_INT, 1ul, NestTest_Level1, NULL) == FALSE) ||
+     (Irq_Register(Core, NEST_TEST_LEVEL3_CPU_INT, 3ul, NestTest_Level3, NULL) == FALSE))
+  {
+    return(FALSE);
+  }
+
+  Irq_Enable(NEST_TEST_LEVEL1_CPU_INT);
+  Irq_Enable(NEST_TEST_LEVEL3_CPU_INT);
+
+  set_cpu_private_timer(NEST_TEST_TIMER, NEST_TEST_PERIOD);
+
+  for(Round = 0ul; Round < NEST_TEST_ROUNDS; Round++)
+  {
+    NestTest_Rounds = Round;
+
+    NEST_TEST_RAISE();
+
+    while(NestTest_Rounds == Round);
+  }
+
+  /* both lines are disabled again for their owners */
+  (void)Irq_Unregister(Core, NEST_TEST_LEVEL3_CPU_INT);
+  (void)Irq_Unregister(Core, NEST_TEST_LEVEL1_CPU_INT);
+
+  Result = ((NestTest_Errors == 0ul) && (NestTest_BodyHits != 0ul)) ? TRUE : FALSE;
+
+  printf("NEST %lu %lu 0x%02lx %s\r\n", NEST_TEST_ROUNDS, NestTest_BodyHits, NestTest_Errors,
+                                       (Result == TRUE) ? "OK" : "FAIL");
+
+  return(Result);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  NestTest_Level1 function
+///
+/// \param  Arg : unused
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void NestTest_Level1(void* Arg)
+{
+  (void)Arg;
+
+  NEST_TEST_CLEAR();
+
+  NestTest_InBody = TRUE;
+
+  NestTest_Errors |= NestTest_Body(NEST_TEST_ITERATIONS);
+
+  NestTest_InBody = FALSE;
+
+  NestTest_Rounds++;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  NestTest_Level3 function
+///
+/// \param  Arg : unused
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void NestTest_Level3(void* Arg)
+{
+  (void)Arg;
+
+  if(NestTest_InBody == TRUE)
+  {
+    NestTest_BodyHits++;
+  }
+
+  NestTest_Clobber();
+
+  set_cpu_private_timer(NEST_TEST_TIMER, NEST_TEST_PERIOD);
+}
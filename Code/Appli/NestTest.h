@@ -0,0 +1,56 @@
+/******************************************************************************************
+  Filename    : NestTest.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Interrupt nesting stress test header file (make NEST_TEST=1)
+
+******************************************************************************************/
+
+#ifndef __NEST_TEST_H__
+#define __NEST_TEST_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* level 1 runs of the body, and loop iterations of each run (ACC must not carry into ACCHI) */
+#ifndef NEST_TEST_ROUNDS
+  #define NEST_TEST_ROUNDS          200ul
+#endif
+
+#ifndef NEST_TEST_ITERATIONS
+  #define NEST_TEST_ITERATIONS      20000ul
+#endif
+
+/* period of the level 3 timer in CPU cycles (odd, so it hits every point of the loop) */
+#ifndef NEST_TEST_PERIOD
+  #define NEST_TEST_PERIOD          997ul
+#endif
+
+/* state lost across a nested interrupt (bits returned by NestTest_Body) */
+#define NEST_TEST_ERR_LOOP          0x01ul    /* LBEG, LEND or LCOUNT */
+#define NEST_TEST_ERR_ACC           0x02ul    /* ACCLO or ACCHI */
+#define NEST_TEST_ERR_SAR           0x04ul
+#define NEST_TEST_ERR_MREG          0x08ul    /* M0..M3 */
+#define NEST_TEST_ERR_AREG          0x10ul    /* a5..a15 */
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+boolean NestTest_Run(void);
+
+#endif
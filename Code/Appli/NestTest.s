@@ -0,0 +1,210 @@
+/******************************************************************************************
+  Filename    : NestTest.s
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Interrupt nesting stress test, the parts that must hold the special
+                registers live (make NEST_TEST=1, see NestTest.c)
+
+******************************************************************************************/
+
+/* error bits returned by NestTest_Body (NEST_TEST_ERR_xxx in NestTest.h) */
+.equ NEST_ERR_LOOP,   0x01
+.equ NEST_ERR_ACC,    0x02
+.equ NEST_ERR_SAR,    0x04
+.equ NEST_ERR_MREG,   0x08
+.equ NEST_ERR_AREG,   0x10
+
+/* state kept live by the level 1 body */
+.equ NEST_SAR,        7
+.equ NEST_M0,         0x7F010003
+.equ NEST_M1,         0x11112222
+.equ NEST_M2,         0x7F030005
+.equ NEST_M3,         0x33334444
+.equ NEST_ACCLO,      0x12340000
+
+/* each iteration adds M0.L * M2.L to the accumulator */
+.equ NEST_ACC_STEP,   15
+
+/*******************************************************************************************
+  \brief  Check the value of a register against its pattern, or an error bit into a2
+          (uses a3)
+********************************************************************************************/
+.macro NestCheck reg, value, error
+                       movi   a3, \value
+                       beq    \reg, a3, .L_nest_check_ok\@
+                       movi   a3, \error
+                       or     a2, a2, a3
+.L_nest_check_ok\@:
+.endm
+
+/*******************************************************************************************
+  \brief  Level 1 body (C: uint32 NestTest_Body(uint32 Iterations)): runs a zero-overhead
+          loop of Iterations (> 0) MAC16 accumulations with SAR, M0..M3 and a5..a15
+          holding known values, so that the level 3 interrupts taken inside the loop find
+          LBEG/LEND/LCOUNT, ACC, M0..M3 and SAR in use. Checks them all after the loop.
+
+  \param  a2 : iterations
+
+  \return a2 : NEST_ERR_xxx bits of the lost state (0 if none)
+********************************************************************************************/
+.section  .iram.hot,"ax"
+.type NestTest_Body, @function
+.align 4
+.global NestTest_Body
+
+NestTest_Body:
+                       addi   sp, sp, -32
+                       s32i   a0,  sp, 0
+                       s32i   a12, sp, 4
+                       s32i   a13, sp, 8
+                       s32i   a14, sp, 12
+                       s32i   a15, sp, 16
+                       s32i   a2,  sp, 20
+
+                       ssai   NEST_SAR
+                       movi   a3, NEST_M0
+                       wsr    a3, m0
+                       movi   a3, NEST_M1
+                       wsr    a3, m1
+                       movi   a3, NEST_M2
+                       wsr    a3, m2
+                       movi   a3, NEST_M3
+                       wsr    a3, m3
+                       movi   a3, NEST_ACCLO
+                       wsr    a3, acclo
+                       movi   a3, 0
+                       wsr    a3, acchi
+
+                       movi   a5,  0xA5A50005
+                       movi   a6,  0xA5A50006
+                       movi   a7,  0xA5A50007
+                       movi   a8,  0xA5A50008
+                       movi   a9,  0xA5A50009
+                       movi   a10, 0xA5A5000A
+                       movi   a11, 0xA5A5000B
+                       movi   a12, 0xA5A5000C
+                       movi   a13, 0xA5A5000D
+                       movi   a14, 0xA5A5000E
+                       movi   a15, 0xA5A5000F
+
+                       movi   a4, 0
+                       loop   a2, .L_nest_loop_end
+                       addi   a4, a4, 1
+                       mula.dd.ll m0, m2
+.L_nest_loop_end:
+
+                       movi   a2, 0
+
+                       /* every iteration ran once and the loop is over (LBEG, LEND, LCOUNT) */
+                       l32i   a3, sp, 20
+                       beq    a4, a3, .L_nest_count_ok
+                       movi   a3, NEST_ERR_LOOP
+                       or     a2, a2, a3
+.L_nest_count_ok:
+                       rsr    a4, lcount
+                       NestCheck a4, 0, NEST_ERR_LOOP
+
+                       /* ACC = NEST_ACCLO + iterations * NEST_ACC_STEP (no carry into ACCHI) */
+                       l32i   a3, sp, 20
+                       movi   a4, NEST_ACC_STEP
+                       mull   a3, a3, a4
+                       movi   a4, NEST_ACCLO
+                       add    a4, a4, a3
+                       rsr    a3, acclo
+                       beq    a3, a4, .L_nest_acclo_ok
+                       movi   a3, NEST_ERR_ACC
+                       or     a2, a2, a3
+.L_nest_acclo_ok:
+                       rsr    a4, acchi
+                       NestCheck a4, 0, NEST_ERR_ACC
+
+                       rsr    a4, sar
+                       NestCheck a4, NEST_SAR, NEST_ERR_SAR
+
+                       rsr    a4, m0
+                       NestCheck a4, NEST_M0, NEST_ERR_MREG
+                       rsr    a4, m1
+                       NestCheck a4, NEST_M1, NEST_ERR_MREG
+                       rsr    a4, m2
+                       NestCheck a4, NEST_M2, NEST_ERR_MREG
+                       rsr    a4, m3
+                       NestCheck a4, NEST_M3, NEST_ERR_MREG
+
+                       NestCheck a5,  0xA5A50005, NEST_ERR_AREG
+                       NestCheck a6,  0xA5A50006, NEST_ERR_AREG
+                       NestCheck a7,  0xA5A50007, NEST_ERR_AREG
+                       NestCheck a8,  0xA5A50008, NEST_ERR_AREG
+                       NestCheck a9,  0xA5A50009, NEST_ERR_AREG
+                       NestCheck a10, 0xA5A5000A, NEST_ERR_AREG
+                       NestCheck a11, 0xA5A5000B, NEST_ERR_AREG
+                       NestCheck a12, 0xA5A5000C, NEST_ERR_AREG
+                       NestCheck a13, 0xA5A5000D, NEST_ERR_AREG
+                       NestCheck a14, 0xA5A5000E, NEST_ERR_AREG
+                       NestCheck a15, 0xA5A5000F, NEST_ERR_AREG
+
+                       l32i   a0,  sp, 0
+                       l32i   a12, sp, 4
+                       l32i   a13, sp, 8
+                       l32i   a14, sp, 12
+                       l32i   a15, sp, 16
+                       addi   sp, sp, 32
+                       ret
+
+.size NestTest_Body, .-NestTest_Body
+
+/*******************************************************************************************
+  \brief  Level 3 side (C: void NestTest_Clobber(void)): overwrites every state the level 1
+          body keeps live, with its own zero-overhead loop (LBEG, LEND, LCOUNT), SAR, ACC,
+          M0..M3 and the caller-saved registers
+
+  \param  void
+
+  \return void
+********************************************************************************************/
+.section  .iram.hot,"ax"
+.type NestTest_Clobber, @function
+.align 4
+.global NestTest_Clobber
+
+NestTest_Clobber:
+                       ssai   29
+                       movi   a2, 0xDEAD0010
+                       wsr    a2, m0
+                       movi   a2, 0xDEAD0011
+                       wsr    a2, m1
+                       movi   a2, 0xDEAD0012
+                       wsr    a2, m2
+                       movi   a2, 0xDEAD0013
+                       wsr    a2, m3
+                       movi   a2, 0xDEAD0014
+                       wsr    a2, acclo
+                       movi   a2, 0x7F
+                       wsr    a2, acchi
+
+                       movi   a3, 3
+                       loop   a3, .L_clobber_loop_end
+                       mula.dd.ll m0, m2
+.L_clobber_loop_end:
+
+                       movi   a2,  0xDEAD0002
+                       movi   a3,  0xDEAD0003
+                       movi   a4,  0xDEAD0004
+                       movi   a5,  0xDEAD0005
+                       movi   a6,  0xDEAD0006
+                       movi   a7,  0xDEAD0007
+                       movi   a8,  0xDEAD0008
+                       movi   a9,  0xDEAD0009
+                       movi   a10, 0xDEAD000A
+                       movi   a11, 0xDEAD000B
+                       ret
+
+.size NestTest_Clobber, .-NestTest_Clobber
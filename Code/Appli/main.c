@@ -21,18 +21,35 @@
 #include "Platform_Types.h"
 #include "esp32s3.h"
 #include "printf.h"
+#include "BootProfile.h"
+#include "Stack.h"
+#include "Irq.h"
+#include "Crash.h"
+#include "IrqLatency.h"
+#include "Timebase.h"
+#include "CpuTimer.h"
+#include "SwTimer.h"
+#include "Ipc.h"
+#include "Spinlock.h"
+#include "AtomicBench.h"
+#include "NestTest.h"
+#include "Os.h"
+#include "TaskPool.h"
+#include "TaskPoolBench.h"
 
 //=============================================================================
 // Defines
 //=============================================================================
 #define CORE0_LED  (1ul << 7)
 #define CORE1_LED  (1ul << 6)
-#define APB_FREQ_MHZ  80000000ul
-#define LED_BLINK_FREQ_1HZ  (APB_FREQ_MHZ/2)
+#define LED_BLINK_PERIOD_MS  500ul
+#define LED_TASK_STACK_SIZE  2048ul
 
 //=============================================================================
 // Macros
 //=============================================================================
+#define READ_CCOUNT(x)         __asm__ volatile ("rsr.ccount %0" : "=r"(x))
+#define READ_CCOMPARE2(x)      __asm__ volatile ("rsr.ccompare2 %0" : "=r"(x))
 
 /* Macros for the WS2812 */
 #define WS2812_ENABLED
@@ -60,22 +77,39 @@
 //=============================================================================
 void main(void);
 void main_c1(void);
-void blink_led(void);
-void systicktimer_1us_base(void);
-void systicktimer_1ms_base(void);
+void blink_led(void* arg);
+void led_task(void* arg);
+void systicktimer_1ms_base(void* arg);
+void ipc_ping(void* arg);
+void ipc_pong(void* arg);
 
-extern void Mcu_StartCore1(void);
+extern void Startup_ReleaseCore1(void);
 extern uint32_t get_core_id(void);
-extern void enable_irq(uint32_t mask);
-extern void set_cpu_private_timer(uint32_t timer_id, uint32_t ticks);
 extern void Mcu_StartCoProcessorRiscV(void);
+extern void systicktimer_1ms_fast(void);
+
+extern volatile unsigned long Startup_RamInitCycles;
 
 //=============================================================================
 // Globals
 //=============================================================================
-volatile uint64_t SysTickTimer1usBase = 0;
 volatile uint64_t SysTickTimer1msBase = 0;
 
+/* one led task pinned to each core */
+static Os_TaskType LedTask[OS_NUM_CORES];
+static uint32 LedTaskStack[OS_NUM_CORES][LED_TASK_STACK_SIZE / sizeof(uint32)];
+
+/* GPIO OUT is read-modify-written by both cores */
+static Spinlock_Type GpioLock = SPINLOCK_INIT;
+
+/* worst level 5 latency in cycles from the CCOMPARE2 match to the 1ms systick handler */
+volatile uint32 IsrLatencyCallIsrPath = 0;
+volatile uint32 IsrLatencyFastPath    = 0;
+
+/* cycles of core 0 from posting a call to core 1 until its reply call runs on core 0 */
+static uint32 IpcPingStart;
+volatile uint32 IpcRoundTrip = 0;
+
 //-----------------------------------------------------------------------------------------
 /// \brief  main function for core 0
 ///
@@ -83,33 +117,107 @@ volatile uint64_t SysTickTimer1msBase = 0;
 ///
 /// \return void
 //-----------------------------------------------------------------------------------------
-void main(void)
+COLD_ATTR void main(void)
 {
+  uint32 Ps;
+
   printf("Hello from core %d\r\n", get_core_id());
 
+  /* send the crash record of the previous run (binary, see Tools/scripts/CrashDecoder.py) */
+  if(Crash_ReportPrevious() == TRUE)
+  {
+    printf("\r\nCrash record of the previous run sent\r\n");
+  }
+
+  printf("RAM init took %lu cycles\r\n", Startup_RamInitCycles);
+
+  /* the us/ns time is read from the SYSTIMER on demand (no 1us tick interrupt) */
+  Timebase_Init();
+
+  printf("CPU clock: %lu MHz, uptime %lu us\r\n", Timebase_GetCpuMhz(), (uint32)SysTickTimer1usBase);
+
+  Ps = Spinlock_LockIrqSave(&GpioLock);
   GPIO->OUT.reg |= CORE0_LED;
+  Spinlock_UnlockIrqRestore(&GpioLock, Ps);
+
+#ifdef NEST_TEST_ENABLED
+  /* level 1 handler state preempted by the level 3 timer (before the scheduler owns both) */
+  (void)NestTest_Run();
+#endif
+
+  /* register and enable the timer2 interrupt on core 0 (int 16) */
+  (void)Irq_Register(0, 16, 5, systicktimer_1ms_base, NULL);
+
+  Irq_Enable(16);
+
+  /* start the systick timer (1ms base, the missed ticks are caught up) */
+  (void)CpuTimer_StartPeriodic(2, 80000, CPU_TIMER_CATCHUP_BURST);
+
+  /* route the cross-core interrupts before the core 1 runs (each core enables its own) */
+  (void)Ipc_Init();
 
-  /* enable timers interrupt on core 0 */
-  enable_irq((1UL << 16) | (1UL << 15) | (1UL << 6) );
+  Ipc_Enable();
 
-  /* start the systick timer (1us base)*/
-  set_cpu_private_timer(0, 80);
+  /* release the core 1 (already started by the startup code) */
+  Startup_ReleaseCore1();
 
-  /* start the systick timer (1ms base)*/
-  set_cpu_private_timer(2, 80000);
+  /* print the boot time of each startup phase */
+  BootProfile_Print();
 
-  /* start the core 1*/
-  Mcu_StartCore1();
+  /* print the stack usage of both cores */
+  printf("Stack core 0: %lu/%lu bytes\r\n", Stack_GetHighWaterMark(STACK_CORE0), Stack_GetSize(STACK_CORE0));
+  printf("Stack core 1: %lu/%lu bytes\r\n", Stack_GetHighWaterMark(STACK_CORE1), Stack_GetSize(STACK_CORE1));
+
+  /* measure the 1ms systick latency on the call_isr path, then switch it to the fast path */
+  while(SysTickTimer1msBase < 10u);
+
+  (void)Irq_RegisterFast(5, systicktimer_1ms_fast);
+
+  while(SysTickTimer1msBase < 20u);
+
+  printf("Level 5 latency: call_isr %lu cycles, fast %lu cycles\r\n", IsrLatencyCallIsrPath, IsrLatencyFastPath);
+
+#ifdef IRQ_LATENCY_ENABLED
+  /* latency histograms of the CPU timer interrupts (see Tools/scripts/IrqLatencyParser.py) */
+  IrqLatency_Print();
+#endif
+
+  /* cross-core call round trip (core 0 -> core 1 -> core 0) */
+  READ_CCOUNT(IpcPingStart);
+
+  (void)Ipc_Post(1, ipc_ping, NULL);
+
+  while(IpcRoundTrip == 0u);
+
+  printf("IPC round trip: %lu cycles\r\n", IpcRoundTrip);
+
+#ifdef ATOMIC_BENCH_ENABLED
+  /* atomics and spinlocks contended by both cores */
+  (void)AtomicBench_Run();
+#endif
 
 #ifdef COPROCESSOR_ENABLED
   /* start the co-processor RISC-V */
   Mcu_StartCoProcessorRiscV();
 #endif
 
-  /* set the private cpu timer1 for core 0 */
-  set_cpu_private_timer(1, LED_BLINK_FREQ_1HZ);
+  /* tickless software timers on the CCOMPARE0 of core 0 (their callbacks may wake tasks with Os_Notify) */
+  (void)SwTimer_Init();
 
-  for(;;);
+  /* fork/join workers on both cores, above the led tasks */
+  (void)TaskPool_Init(2);
+
+#ifdef TASKPOOL_BENCH_ENABLED
+  /* FIR filter on core 0 alone, then spread over both cores by the task pool */
+  (void)TaskPoolBench_Start(2);
+#endif
+
+  /* blink each core led from a task pinned to that core */
+  (void)Os_CreateTask(&LedTask[0], led_task, NULL, 1, 0, LedTaskStack[0], LED_TASK_STACK_SIZE);
+  (void)Os_CreateTask(&LedTask[1], led_task, NULL, 1, 1, LedTaskStack[1], LED_TASK_STACK_SIZE);
+
+  /* core 0 becomes the idle task of its scheduler */
+  Os_Start();
 }
 
 //-----------------------------------------------------------------------------------------
@@ -119,19 +227,21 @@ void main(void)
 ///
 /// \return void
 //-----------------------------------------------------------------------------------------
-void main_c1(void)
+COLD_ATTR void main_c1(void)
 {
+  uint32 Ps;
+
   printf("Hello from core %d\r\n", get_core_id());
 
+  Ps = Spinlock_LockIrqSave(&GpioLock);
   GPIO->OUT.reg |= CORE1_LED;
+  Spinlock_UnlockIrqRestore(&GpioLock, Ps);
 
-  /* enable timer1 interrupt on core 1 */
-  enable_irq((uint32_t)(1UL << 15));
-
-  /* set the private cpu timer1 for core 1 */
-  set_cpu_private_timer(1, LED_BLINK_FREQ_1HZ);
+  /* receive the calls posted by core 0 */
+  Ipc_Enable();
 
-  for(;;);
+  /* core 1 becomes the idle task of its scheduler (the timer1 is its tick) */
+  Os_Start();
 }
 //-----------------------------------------------------------------------------------------
 /// \brief  
@@ -140,23 +250,70 @@ void main_c1(void)
 ///
 /// \return 
 //-----------------------------------------------------------------------------------------
-void systicktimer_1us_base(void)
+IRAM_ATTR void systicktimer_1ms_base(void* arg)
 {
-  SysTickTimer1usBase++;
-  set_cpu_private_timer(0, 80);
+  uint32 Ccount;
+  uint32 Ccompare;
+
+  (void)arg;
+
+  READ_CCOUNT(Ccount);
+  READ_CCOMPARE2(Ccompare);
+
+  if((Ccount - Ccompare) > IsrLatencyCallIsrPath)
+  {
+    IsrLatencyCallIsrPath = Ccount - Ccompare;
+  }
+
+  SysTickTimer1msBase++;
+  (void)CpuTimer_Rearm(2);
 }
 
 //-----------------------------------------------------------------------------------------
-/// \brief  
+/// \brief  ipc_ping function (core 1)
 ///
-/// \param 
+/// \param  arg : unused
 ///
-/// \return 
+/// \return void
 //-----------------------------------------------------------------------------------------
-void systicktimer_1ms_base(void)
+IRAM_ATTR void ipc_ping(void* arg)
 {
-  SysTickTimer1msBase++;
-  set_cpu_private_timer(2, 80000);
+  (void)Ipc_Post(0, ipc_pong, arg);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  ipc_pong function (core 0)
+///
+/// \param  arg : unused
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR void ipc_pong(void* arg)
+{
+  uint32 Ccount;
+
+  (void)arg;
+
+  READ_CCOUNT(Ccount);
+
+  IpcRoundTrip = Ccount - IpcPingStart;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  led_task function (one instance on each core)
+///
+/// \param  arg : unused
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void led_task(void* arg)
+{
+  for(;;)
+  {
+    blink_led(arg);
+
+    Os_Delay(OS_MS_TO_TICKS(LED_BLINK_PERIOD_MS));
+  }
 }
 
 //-----------------------------------------------------------------------------------------
@@ -166,19 +323,21 @@ void systicktimer_1ms_base(void)
 ///
 /// \return 
 //-----------------------------------------------------------------------------------------
-void blink_led(void)
+IRAM_ATTR void blink_led(void* arg)
 {
 #ifdef WS2812_ENABLED
   static uint32_t color = 0;
 #endif
+  uint32 Ps;
+
+  (void)arg;
 
-  /* reload the private timer1 */
-  set_cpu_private_timer(1, LED_BLINK_FREQ_1HZ);
-  
   /* toggle the leds */
   if(get_core_id())
   {
+    Ps = Spinlock_LockIrqSave(&GpioLock);
     GPIO->OUT.reg ^= CORE1_LED;
+    Spinlock_UnlockIrqRestore(&GpioLock, Ps);
 
 #ifdef WS2812_ENABLED
     if(color == 0)
@@ -200,6 +359,8 @@ void blink_led(void)
   }
   else
   {
+    Ps = Spinlock_LockIrqSave(&GpioLock);
     GPIO->OUT.reg ^= CORE0_LED;
+    Spinlock_UnlockIrqRestore(&GpioLock, Ps);
   }
 }
@@ -0,0 +1,180 @@
+/******************************************************************************************
+  Filename    : Cache.c
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Flash cache (XIP) configuration for ESP32-S3
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "esp32s3.h"
+#include "stdint.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* MMU table shared by the ibus (0x42000000) and the dbus (0x3C000000), one entry maps a 64KB flash page */
+#define CACHE_MMU_TABLE               ((volatile uint32_t*)0x600C5000UL)
+#define CACHE_MMU_ENTRY_NUM           512ul
+#define CACHE_MMU_ENTRY_INVALID       (1ul << 14)
+#define CACHE_MMU_PAGE_SHIFT          16ul
+#define CACHE_MMU_PAGE_MASK           0xFFFFul
+#define CACHE_MMU_VADDR_MASK          0x01FFFFFFul
+
+#define CACHE_IROM_START              0x42000000ul
+#define CACHE_IROM_END                0x44000000ul
+#define CACHE_DROM_START              0x3C000000ul
+#define CACHE_DROM_END                0x3E000000ul
+
+/* the last dbus page is reserved by the linker script as a scratch window to read the image header */
+#define CACHE_SCRATCH_ENTRY           (CACHE_MMU_ENTRY_NUM - 1ul)
+#define CACHE_SCRATCH_VADDR           (CACHE_DROM_START + (CACHE_SCRATCH_ENTRY << CACHE_MMU_PAGE_SHIFT))
+
+/* esptool image layout (the image is flashed at offset 0 and built with --ram-only-header) */
+#define CACHE_IMAGE_MAGIC             0xE9ul
+#define CACHE_IMAGE_HEADER_SIZE       24ul
+#define CACHE_IMAGE_SEGMENT_HDR_SIZE  8ul
+#define CACHE_IMAGE_MAX_FLASH_SEGS    16ul
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+void Cache_InitFlashXip(void);
+static uint32_t Cache_FlashRead32(uint32_t Offset);
+static void Cache_MapSegment(uint32_t Vaddr, uint32_t FlashOffset, uint32_t Size);
+static void Cache_InvalidateAll(void);
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Cache_InitFlashXip function
+///
+/// \descr  Maps the flash segments of the running image (.flash.text and .flash.rodata)
+///         into the ibus/dbus address space. The function runs from IRAM before the
+///         C runtime is initialized, it must not use .bss nor any flash-resident data.
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void Cache_InitFlashXip(void)
+{
+  uint32_t Offset;
+  uint32_t Header;
+
+  /* enable the caches and the buses of both cores */
+  EXTMEM->ICACHE_CTRL1.reg = 0;
+  EXTMEM->DCACHE_CTRL1.reg = 0;
+  EXTMEM->ICACHE_CTRL.bit.ICACHE_ENABLE = 1;
+  EXTMEM->DCACHE_CTRL.bit.DCACHE_ENABLE = 1;
+
+  /* drop any mapping left by the bootROM */
+  for(uint32_t entry = 0; entry < CACHE_MMU_ENTRY_NUM; entry++)
+  {
+    CACHE_MMU_TABLE[entry] = CACHE_MMU_ENTRY_INVALID;
+  }
+
+  Header = Cache_FlashRead32(0);
+
+  if((Header & 0xFFul) == CACHE_IMAGE_MAGIC)
+  {
+    /* skip the RAM segments (the only ones counted in the header, they are loaded by the bootROM) */
+    const uint32_t RamSegments = (Header >> 8) & 0xFFul;
+
+    Offset = CACHE_IMAGE_HEADER_SIZE;
+
+    for(uint32_t seg = 0; seg < RamSegments; seg++)
+    {
+      Offset += CACHE_IMAGE_SEGMENT_HDR_SIZE + Cache_FlashRead32(Offset + 4ul);
+    }
+
+    /* skip the checksum byte (placed on the last byte of a 16-byte block) */
+    Offset = (Offset | 15ul) + 1ul;
+
+    /* map the flash segments (padding segments have a null load address) */
+    for(uint32_t seg = 0; seg < CACHE_IMAGE_MAX_FLASH_SEGS; seg++)
+    {
+      const uint32_t Vaddr = Cache_FlashRead32(Offset);
+      const uint32_t Size  = Cache_FlashRead32(Offset + 4ul);
+
+      if(((Vaddr >= CACHE_IROM_START) && (Vaddr < CACHE_IROM_END)) || ((Vaddr >= CACHE_DROM_START) && (Vaddr < CACHE_DROM_END)))
+      {
+        Cache_MapSegment(Vaddr, Offset + CACHE_IMAGE_SEGMENT_HDR_SIZE, Size);
+      }
+      else if(Vaddr != 0ul)
+      {
+        /* end of the segment list */
+        break;
+      }
+
+      Offset += CACHE_IMAGE_SEGMENT_HDR_SIZE + Size;
+    }
+  }
+
+  /* release the scratch window and start from clean caches */
+  CACHE_MMU_TABLE[CACHE_SCRATCH_ENTRY] = CACHE_MMU_ENTRY_INVALID;
+  Cache_InvalidateAll();
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Cache_FlashRead32 function
+///
+/// \param  Offset : word-aligned flash offset
+///
+/// \return the flash word
+//-----------------------------------------------------------------------------------------
+static uint32_t Cache_FlashRead32(uint32_t Offset)
+{
+  CACHE_MMU_TABLE[CACHE_SCRATCH_ENTRY] = Offset >> CACHE_MMU_PAGE_SHIFT;
+  Cache_InvalidateAll();
+
+  return *(volatile uint32_t*)(CACHE_SCRATCH_VADDR + (Offset & CACHE_MMU_PAGE_MASK));
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Cache_MapSegment function
+///
+/// \param  Vaddr       : virtual load address of the segment
+///         FlashOffset : flash offset of the segment data
+///         Size        : length of the segment in bytes
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Cache_MapSegment(uint32_t Vaddr, uint32_t FlashOffset, uint32_t Size)
+{
+  /* note: esptool aligns the segment data so that the flash offset and the vaddr share the same page offset */
+  const uint32_t FirstEntry = (Vaddr & CACHE_MMU_VADDR_MASK) >> CACHE_MMU_PAGE_SHIFT;
+  const uint32_t FirstPage  = FlashOffset >> CACHE_MMU_PAGE_SHIFT;
+  const uint32_t Pages      = ((Vaddr & CACHE_MMU_PAGE_MASK) + Size + CACHE_MMU_PAGE_MASK) >> CACHE_MMU_PAGE_SHIFT;
+
+  for(uint32_t page = 0; (page < Pages) && ((FirstEntry + page) < CACHE_SCRATCH_ENTRY); page++)
+  {
+    CACHE_MMU_TABLE[FirstEntry + page] = FirstPage + page;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Cache_InvalidateAll function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Cache_InvalidateAll(void)
+{
+  EXTMEM->ICACHE_SYNC_CTRL.bit.ICACHE_INVALIDATE_ENA = 1;
+  while(EXTMEM->ICACHE_SYNC_CTRL.bit.ICACHE_SYNC_DONE == 0);
+
+  EXTMEM->DCACHE_SYNC_CTRL.bit.DCACHE_INVALIDATE_ENA = 1;
+  while(EXTMEM->DCACHE_SYNC_CTRL.bit.DCACHE_SYNC_DONE == 0);
+}
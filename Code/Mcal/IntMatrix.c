@@ -0,0 +1,264 @@
+/******************************************************************************************
+  Filename    : IntMatrix.c
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Interrupt matrix driver (peripheral source to CPU interrupt routing)
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "IntMatrix.h"
+#include "esp32s3.h"
+#include "core-isa.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* reset value of the map registers: CPU timer 2 is an internal interrupt, the matrix cannot raise it */
+#define INTMATRIX_LINE_DISCONNECTED   16ul
+
+/* CPU interrupts driven by the matrix */
+#define INTMATRIX_LINES_EXTERN        (XCHAL_INTTYPE_MASK_EXTERN_LEVEL | XCHAL_INTTYPE_MASK_EXTERN_EDGE)
+
+/* only the level-triggered lines are allocated automatically (the peripheral sources are level signals) */
+#define INTMATRIX_LINES_AUTO          XCHAL_INTTYPE_MASK_EXTERN_LEVEL
+
+//=============================================================================
+// Types
+//=============================================================================
+typedef struct
+{
+  uint8 Connected;
+  uint8 Core;
+  uint8 CpuInt;
+}IntMatrix_SourceStateType;
+
+//=============================================================================
+// Globals
+//=============================================================================
+
+/* note: the allocation is not protected against concurrent calls from both cores */
+static IntMatrix_SourceStateType IntMatrix_Source[INTMATRIX_NUM_SOURCES];
+static uint32 IntMatrix_UsedLines[IRQ_NUM_CORES];
+
+//=============================================================================
+// Static functions
+//=============================================================================
+static volatile uint32_t* IntMatrix_GetMapReg(uint32 Core, uint32 Source);
+static uint32 IntMatrix_SelectCore(uint32 Level);
+static uint32 IntMatrix_CountLines(uint32 Lines);
+
+//-----------------------------------------------------------------------------------------
+/// \brief  IntMatrix_Allocate function
+///
+/// \descr  Picks a free level-triggered CPU interrupt of the given level on the core,
+///         routes the source to it and registers the handler. The line must then be
+///         enabled with Irq_Enable(pRoute->CpuInt) on the selected core.
+///
+/// \param  Source  : peripheral interrupt source (IRQn_Type)
+///         Core    : 0, 1 or INTMATRIX_CORE_ANY
+///         Level   : priority level (1..IRQ_MAX_LEVEL)
+///         Handler : handler called by Irq_Dispatch
+///         Arg     : handler argument
+///         pRoute  : selected core and CPU interrupt
+///
+/// \return TRUE if a line is allocated
+//-----------------------------------------------------------------------------------------
+boolean IntMatrix_Allocate(uint32 Source, uint32 Core, uint32 Level, Irq_HandlerType Handler, void* Arg, IntMatrix_RouteType* pRoute)
+{
+  uint32 FreeLines;
+  uint32 CpuInt;
+
+  if((Source >= INTMATRIX_NUM_SOURCES) || (IntMatrix_Source[Source].Connected != 0u) || (pRoute == NULL))
+  {
+    return(FALSE);
+  }
+
+  if(Core == INTMATRIX_CORE_ANY)
+  {
+    Core = IntMatrix_SelectCore(Level);
+  }
+
+  if(Core >= IRQ_NUM_CORES)
+  {
+    return(FALSE);
+  }
+
+  FreeLines = INTMATRIX_LINES_AUTO & Irq_GetLevelMask(Level) & ~IntMatrix_UsedLines[Core];
+
+  if((Level == 0ul) || (Level > IRQ_MAX_LEVEL) || (FreeLines == 0ul))
+  {
+    return(FALSE);
+  }
+
+  /* lowest free line of the level */
+  CpuInt = (uint32)__builtin_ctz(FreeLines);
+
+  if(Irq_Register(Core, CpuInt, Level, Handler, Arg) == FALSE)
+  {
+    return(FALSE);
+  }
+
+  (void)IntMatrix_Connect(Source, Core, CpuInt);
+
+  pRoute->Core   = Core;
+  pRoute->CpuInt = CpuInt;
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  IntMatrix_Connect function
+///
+/// \descr  Routes the source to a fixed CPU interrupt (the handler is registered
+///         separately with Irq_Register). Several sources may share one line.
+///
+/// \param  Source : peripheral interrupt source (IRQn_Type)
+///         Core   : 0 or 1
+///         CpuInt : external CPU interrupt (level or edge triggered)
+///
+/// \return TRUE if the source is routed
+//-----------------------------------------------------------------------------------------
+boolean IntMatrix_Connect(uint32 Source, uint32 Core, uint32 CpuInt)
+{
+  if((Source >= INTMATRIX_NUM_SOURCES) || (Core >= IRQ_NUM_CORES) || (CpuInt >= IRQ_NUM_CPU_INT))
+  {
+    return(FALSE);
+  }
+
+  if((INTMATRIX_LINES_EXTERN & (1ul << CpuInt)) == 0ul)
+  {
+    return(FALSE);
+  }
+
+  if(IntMatrix_Source[Source].Connected != 0u)
+  {
+    (void)IntMatrix_Disconnect(Source);
+  }
+
+  *IntMatrix_GetMapReg(Core, Source) = CpuInt;
+
+  IntMatrix_Source[Source].Connected = 1u;
+  IntMatrix_Source[Source].Core      = (uint8)Core;
+  IntMatrix_Source[Source].CpuInt    = (uint8)CpuInt;
+  IntMatrix_UsedLines[Core]         |= (1ul << CpuInt);
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  IntMatrix_Disconnect function
+///
+/// \descr  Routes the source back to the reset line. The CPU interrupt is released
+///         when no other source uses it (its handler stays registered).
+///
+/// \param  Source : peripheral interrupt source (IRQn_Type)
+///
+/// \return TRUE if the source was connected
+//-----------------------------------------------------------------------------------------
+boolean IntMatrix_Disconnect(uint32 Source)
+{
+  uint32 Core;
+  uint32 CpuInt;
+
+  if((Source >= INTMATRIX_NUM_SOURCES) || (IntMatrix_Source[Source].Connected == 0u))
+  {
+    return(FALSE);
+  }
+
+  Core   = IntMatrix_Source[Source].Core;
+  CpuInt = IntMatrix_Source[Source].CpuInt;
+
+  *IntMatrix_GetMapReg(Core, Source) = INTMATRIX_LINE_DISCONNECTED;
+
+  IntMatrix_Source[Source].Connected = 0u;
+
+  for(uint32 src = 0; src < INTMATRIX_NUM_SOURCES; src++)
+  {
+    if((IntMatrix_Source[src].Connected != 0u) && (IntMatrix_Source[src].Core == Core) && (IntMatrix_Source[src].CpuInt == CpuInt))
+    {
+      return(TRUE);
+    }
+  }
+
+  IntMatrix_UsedLines[Core] &= ~(1ul << CpuInt);
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  IntMatrix_GetRoute function
+///
+/// \param  Source : peripheral interrupt source (IRQn_Type)
+///         pRoute : core and CPU interrupt of the source
+///
+/// \return TRUE if the source is connected
+//-----------------------------------------------------------------------------------------
+boolean IntMatrix_GetRoute(uint32 Source, IntMatrix_RouteType* pRoute)
+{
+  if((Source >= INTMATRIX_NUM_SOURCES) || (IntMatrix_Source[Source].Connected == 0u) || (pRoute == NULL))
+  {
+    return(FALSE);
+  }
+
+  pRoute->Core   = IntMatrix_Source[Source].Core;
+  pRoute->CpuInt = IntMatrix_Source[Source].CpuInt;
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  IntMatrix_GetMapReg function
+///
+/// \param  Core   : 0 or 1
+///         Source : peripheral interrupt source
+///
+/// \return map register of the source (the map registers are ordered by source number)
+//-----------------------------------------------------------------------------------------
+static volatile uint32_t* IntMatrix_GetMapReg(uint32 Core, uint32 Source)
+{
+  volatile uint32_t* MapBase = (Core == 0ul) ? &INTERRUPT_CORE0->PRO_MAC_INTR_MAP.reg
+                                             : &INTERRUPT_CORE1->APP_MAC_INTR_MAP.reg;
+
+  return(&MapBase[Source]);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  IntMatrix_SelectCore function
+///
+/// \param  Level : priority level
+///
+/// \return core with the most free lines at the level (core 0 on a tie)
+//-----------------------------------------------------------------------------------------
+static uint32 IntMatrix_SelectCore(uint32 Level)
+{
+  const uint32 LevelLines = INTMATRIX_LINES_AUTO & Irq_GetLevelMask(Level);
+  const uint32 FreeCore0  = IntMatrix_CountLines(LevelLines & ~IntMatrix_UsedLines[0]);
+  const uint32 FreeCore1  = IntMatrix_CountLines(LevelLines & ~IntMatrix_UsedLines[1]);
+
+  return((FreeCore1 > FreeCore0) ? 1ul : 0ul);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  IntMatrix_CountLines function
+///
+/// \param  Lines : CPU interrupt bitmap
+///
+/// \return number of set bits
+//-----------------------------------------------------------------------------------------
+static uint32 IntMatrix_CountLines(uint32 Lines)
+{
+  return((uint32)__builtin_popcount(Lines));
+}
@@ -0,0 +1,54 @@
+/******************************************************************************************
+  Filename    : IntMatrix.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Interrupt matrix driver header file
+
+******************************************************************************************/
+
+#ifndef __INT_MATRIX_H__
+#define __INT_MATRIX_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+#include "Irq.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* number of peripheral interrupt sources (IRQn_Type of esp32s3.h) */
+#define INTMATRIX_NUM_SOURCES       99ul
+
+/* core argument of IntMatrix_Allocate: pick the core with the fewest allocated lines */
+#define INTMATRIX_CORE_ANY          0xFFul
+
+//=============================================================================
+// Types
+//=============================================================================
+typedef struct
+{
+  uint32 Core;
+  uint32 CpuInt;
+}IntMatrix_RouteType;
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+boolean IntMatrix_Allocate(uint32 Source, uint32 Core, uint32 Level, Irq_HandlerType Handler, void* Arg, IntMatrix_RouteType* pRoute);
+boolean IntMatrix_Connect(uint32 Source, uint32 Core, uint32 CpuInt);
+boolean IntMatrix_Disconnect(uint32 Source);
+boolean IntMatrix_GetRoute(uint32 Source, IntMatrix_RouteType* pRoute);
+
+#endif
@@ -20,6 +20,26 @@
 //=============================================================================
 #include "esp32s3.h"
 #include "stdint.h"
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* PRO CPU reset cause: software CPU reset (only the CPU is reset, the peripherals keep their configuration) */
+#define MCU_RESET_CAUSE_CPU0_SW     0x0Cul
+
+#define MCU_WARM_STATE_MAGIC        0x3A9D57C1ul
+
+//=============================================================================
+// Types
+//=============================================================================
+typedef struct
+{
+  uint32 Magic;
+  uint32 SysClkConf;  /* SYSCLK_CONF read back after the clock configuration */
+  uint32 Check;       /* inverted xor of the fields above */
+}Mcu_WarmStateType;
 
 //=============================================================================
 // Prototypes
@@ -29,6 +49,20 @@ void _start(void);
 void Mcu_ClockInit(void);
 void Mcu_InitCore(void);
 void Mcu_StartCoProcessorRiscV(void);
+boolean Mcu_IsWarmReset(void);
+void Mcu_SoftwareReset(void);
+static boolean Mcu_DetectWarmReset(void);
+static uint32 Mcu_WarmStateCheck(void);
+
+//=============================================================================
+// Globals
+//=============================================================================
+
+/* state block validated on a warm reset (note: not loaded nor cleared, it is written after the clock configuration) */
+static volatile Mcu_WarmStateType Mcu_WarmState NOINIT_ATTR;
+
+/* note: placed in .data as it is set before the RAM initialization */
+static volatile boolean Mcu_WarmReset __attribute__((section(".data"))) = FALSE;
 
 //-----------------------------------------------------------------------------------------
 /// \brief  
@@ -37,7 +71,7 @@ void Mcu_StartCoProcessorRiscV(void);
 ///
 /// \return 
 //-----------------------------------------------------------------------------------------
-void Mcu_StartCore1(void)
+COLD_ATTR void Mcu_StartCore1(void)
 {
   /* unstall core 1 */
   RTC_CNTL->OPTIONS0.bit.SW_STALL_APPCPU_C0            = 0;
@@ -66,11 +100,20 @@ void Mcu_StartCore1(void)
 ///
 /// \return 
 //-----------------------------------------------------------------------------------------
-void Mcu_ClockInit(void)
+COLD_ATTR void Mcu_ClockInit(void)
 {
-   /* set the core clock to 240 MHz and APB clock to 80 MHz*/
-   SYSTEM->CPU_PERI_CLK_EN.reg = 7;
-   SYSTEM->SYSCLK_CONF.reg     = 0x401;
+  /* keep the clock configuration of a warm reset if it is still the one recorded in the state block */
+  if((Mcu_WarmReset == FALSE) || (SYSTEM->SYSCLK_CONF.reg != Mcu_WarmState.SysClkConf))
+  {
+    /* set the core clock to 240 MHz and APB clock to 80 MHz*/
+    SYSTEM->CPU_PERI_CLK_EN.reg = 7;
+    SYSTEM->SYSCLK_CONF.reg     = 0x401;
+  }
+
+  /* record the configured state for the next warm reset */
+  Mcu_WarmState.Magic      = MCU_WARM_STATE_MAGIC;
+  Mcu_WarmState.SysClkConf = SYSTEM->SYSCLK_CONF.reg;
+  Mcu_WarmState.Check      = Mcu_WarmStateCheck();
 }
 
 //-----------------------------------------------------------------------------------------
@@ -80,24 +123,101 @@ void Mcu_ClockInit(void)
 ///
 /// \return 
 //-----------------------------------------------------------------------------------------
-void Mcu_InitCore(void)
+COLD_ATTR void Mcu_InitCore(void)
 {
-  /* disable the super watchdog */
-  RTC_CNTL->SWD_WPROTECT.reg = 0x8F1D312A;
-  RTC_CNTL->WDTCONFIG1.reg = 0;
-  RTC_CNTL->SWD_CONF.reg = (1ul << 30);
-  RTC_CNTL->SWD_WPROTECT.reg = 0;
-  
-  /* disable Timer Group 0 WDT */
-  TIMG0->WDTWPROTECT.reg = 0x50d83aa1;
-  TIMG0->WDTCONFIG0.reg  = 0;
-  TIMG0->WDTWPROTECT.reg = 0;
-
-  /* set all gpio as output low */
-  GPIO->ENABLE_W1TS.reg = 0xFFFFFFFF;
-  GPIO->ENABLE1_W1TS.reg = 0xFFFFFFFF;
-  GPIO->OUT.reg   = 0;
-  GPIO->OUT1.reg  = 0; 
+  Mcu_WarmReset = Mcu_DetectWarmReset();
+
+  /* note: the bootROM may re-arm the watchdogs even on a warm reset, they are only skipped if still disabled */
+  if((Mcu_WarmReset == FALSE) || (RTC_CNTL->SWD_CONF.bit.SWD_DISABLE == 0) || (TIMG0->WDTCONFIG0.bit.WDT_EN == 1))
+  {
+    /* disable the super watchdog */
+    RTC_CNTL->SWD_WPROTECT.reg = 0x8F1D312A;
+    RTC_CNTL->WDTCONFIG1.reg = 0;
+    RTC_CNTL->SWD_CONF.reg = (1ul << 30);
+    RTC_CNTL->SWD_WPROTECT.reg = 0;
+
+    /* disable Timer Group 0 WDT */
+    TIMG0->WDTWPROTECT.reg = 0x50d83aa1;
+    TIMG0->WDTCONFIG0.reg  = 0;
+    TIMG0->WDTWPROTECT.reg = 0;
+  }
+
+  /* keep the outputs of a warm reset glitch-free */
+  if(Mcu_WarmReset == FALSE)
+  {
+    /* set all gpio as output low */
+    GPIO->ENABLE_W1TS.reg = 0xFFFFFFFF;
+    GPIO->ENABLE1_W1TS.reg = 0xFFFFFFFF;
+    GPIO->OUT.reg   = 0;
+    GPIO->OUT1.reg  = 0;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Mcu_IsWarmReset function
+///
+/// \param  void
+///
+/// \return TRUE if the running boot is a validated warm reset (set by Mcu_InitCore)
+//-----------------------------------------------------------------------------------------
+boolean Mcu_IsWarmReset(void)
+{
+  return(Mcu_WarmReset);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Mcu_SoftwareReset function
+///
+/// \descr  Resets the PRO CPU, the next boot takes the warm reset path. Called on core 0.
+///         The APP CPU is stalled and held in reset first, so it does not run out of the
+///         SRAM while the bootROM and the warm startup rewrite it (it is released again
+///         by Mcu_StartCore1).
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+COLD_ATTR void Mcu_SoftwareReset(void)
+{
+  /* stall core 1 (the stall code is {C1, C0} = 0x86) */
+  RTC_CNTL->SW_CPU_STALL.bit.SW_STALL_APPCPU_C1 = 0x21;
+  RTC_CNTL->OPTIONS0.bit.SW_STALL_APPCPU_C0     = 0x02;
+
+  /* and keep it in reset */
+  SYSTEM->CORE_1_CONTROL_0.bit.CONTROL_CORE_1_RESETING = 1;
+
+  RTC_CNTL->OPTIONS0.bit.SW_PROCPU_RST = 1;
+
+  for(;;);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Mcu_DetectWarmReset function
+///
+/// \param  void
+///
+/// \return TRUE on a software CPU reset with a valid state block
+//-----------------------------------------------------------------------------------------
+static boolean Mcu_DetectWarmReset(void)
+{
+  if(RTC_CNTL->RESET_STATE.bit.RESET_CAUSE_PROCPU != MCU_RESET_CAUSE_CPU0_SW)
+  {
+    return(FALSE);
+  }
+
+  return(((Mcu_WarmState.Magic == MCU_WARM_STATE_MAGIC) && (Mcu_WarmState.Check == Mcu_WarmStateCheck())) ? TRUE : FALSE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Mcu_WarmStateCheck function
+///
+/// \param  void
+///
+/// \return the check word of the state block
+//-----------------------------------------------------------------------------------------
+static uint32 Mcu_WarmStateCheck(void)
+{
+  return(~(Mcu_WarmState.Magic ^ Mcu_WarmState.SysClkConf));
 }
 
 //-----------------------------------------------------------------------------------------
@@ -107,7 +227,7 @@ void Mcu_InitCore(void)
 ///
 /// \return 
 //-----------------------------------------------------------------------------------------
-void Mcu_StartCoProcessorRiscV(void)
+COLD_ATTR void Mcu_StartCoProcessorRiscV(void)
 {
   RTC_CNTL->COCPU_CTRL.bit.COCPU_SHUT_RESET_EN     = 1;
   RTC_CNTL->ULP_CP_TIMER.reg                       = 0;
@@ -0,0 +1,203 @@
+/******************************************************************************************
+  Filename    : Timebase.c
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Free-running timebase read on demand (SYSTIMER unit 0 and CCOUNT)
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Timebase.h"
+#include "esp32s3.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* CCOUNT rate assumed before Timebase_Init (80 cycles per us, as the CPU timer reloads of main) */
+#define TIMEBASE_DEFAULT_CPU_MHZ    80ul
+
+/* calibration window of the CCOUNT rate (1 ms) */
+#define TIMEBASE_CALIB_TICKS        (1000ul * TIMEBASE_SYSTIMER_MHZ)
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define TIMEBASE_READ_CCOUNT(x)     __asm__ volatile ("rsr.ccount %0" : "=r"(x))
+#define TIMEBASE_LOCK(ps)           __asm__ volatile ("rsil %0, 15" : "=r"(ps) : : "memory")
+#define TIMEBASE_UNLOCK(ps)         __asm__ volatile ("wsr.ps %0\n\trsync" : : "r"(ps) : "memory")
+
+//=============================================================================
+// Externs
+//=============================================================================
+extern uint32 get_core_id(void);
+
+//=============================================================================
+// Globals
+//=============================================================================
+static uint32 Timebase_CpuMhz = TIMEBASE_DEFAULT_CPU_MHZ;
+
+/* CCOUNT extension: last value read and number of wraps on each core */
+static uint32 Timebase_LastCcount[TIMEBASE_NUM_CORES];
+static uint32 Timebase_CcountWraps[TIMEBASE_NUM_CORES];
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Timebase_Init function
+///
+/// \descr  Measures the CCOUNT rate over 1 ms of SYSTIMER, called once after the clock
+///         configuration (the SYSTIMER itself runs from the chip reset).
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+COLD_ATTR void Timebase_Init(void)
+{
+  uint32 CcountStart;
+  uint32 CcountEnd;
+  const uint64 Start = Timebase_GetTicks();
+
+  TIMEBASE_READ_CCOUNT(CcountStart);
+
+  while((Timebase_GetTicks() - Start) < TIMEBASE_CALIB_TICKS);
+
+  TIMEBASE_READ_CCOUNT(CcountEnd);
+
+  /* rounded to the MHz */
+  Timebase_CpuMhz = ((CcountEnd - CcountStart) + 500ul) / 1000ul;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Timebase_GetTicks function
+///
+/// \descr  Reads the 52-bit SYSTIMER unit 0 counter. The other core may trigger an update
+///         between the two halves, the read is repeated until the high word is stable.
+///
+/// \param  void
+///
+/// \return SYSTIMER ticks (16 MHz) since the chip reset
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR uint64 Timebase_GetTicks(void)
+{
+  uint32 Hi;
+  uint32 Lo;
+
+  SYSTIMER->UNIT0_OP.bit.TIMER_UNIT0_UPDATE = 1;
+  while(SYSTIMER->UNIT0_OP.bit.TIMER_UNIT0_VALUE_VALID == 0);
+
+  do
+  {
+    Hi = SYSTIMER->UNIT0_VALUE_HI.reg;
+    Lo = SYSTIMER->UNIT0_VALUE_LO.reg;
+  } while(Hi != SYSTIMER->UNIT0_VALUE_HI.reg);
+
+  return(((uint64)Hi << 32) | Lo);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Timebase_GetUs function
+///
+/// \param  void
+///
+/// \return microseconds since the chip reset
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR uint64 Timebase_GetUs(void)
+{
+  return(Timebase_GetTicks() / TIMEBASE_SYSTIMER_MHZ);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Timebase_GetNs function
+///
+/// \param  void
+///
+/// \return nanoseconds since the chip reset (62.5 ns resolution)
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR uint64 Timebase_GetNs(void)
+{
+  return((Timebase_GetTicks() * 1000ull) / TIMEBASE_SYSTIMER_MHZ);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Timebase_GetCycles function
+///
+/// \descr  CCOUNT of the calling core extended to 64 bits. A wrap is only detected if
+///         the function runs at least once per 2^32 cycles on the core (53 s at 80 MHz),
+///         use the SYSTIMER based functions for longer intervals.
+///
+/// \param  void
+///
+/// \return CPU cycles of the calling core
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR uint64 Timebase_GetCycles(void)
+{
+  const uint32 Core = get_core_id();
+  uint32 Ccount;
+  uint32 Wraps;
+  uint32 Ps;
+
+  TIMEBASE_LOCK(Ps);
+
+  TIMEBASE_READ_CCOUNT(Ccount);
+
+  if(Ccount < Timebase_LastCcount[Core])
+  {
+    Timebase_CcountWraps[Core]++;
+  }
+
+  Timebase_LastCcount[Core] = Ccount;
+  Wraps = Timebase_CcountWraps[Core];
+
+  TIMEBASE_UNLOCK(Ps);
+
+  return(((uint64)Wraps << 32) | Ccount);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Timebase_CyclesToNs function
+///
+/// \param  Cycles : CPU cycles
+///
+/// \return duration in nanoseconds at the calibrated CCOUNT rate
+//-----------------------------------------------------------------------------------------
+uint64 Timebase_CyclesToNs(uint64 Cycles)
+{
+  return((Cycles * 1000ull) / Timebase_CpuMhz);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Timebase_GetCpuMhz function
+///
+/// \param  void
+///
+/// \return CCOUNT rate in MHz (calibrated by Timebase_Init)
+//-----------------------------------------------------------------------------------------
+uint32 Timebase_GetCpuMhz(void)
+{
+  return(Timebase_CpuMhz);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Timebase_DelayUs function
+///
+/// \param  Us : busy wait duration in microseconds
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void Timebase_DelayUs(uint32 Us)
+{
+  const uint64 Start = Timebase_GetTicks();
+
+  while((Timebase_GetTicks() - Start) < ((uint64)Us * TIMEBASE_SYSTIMER_MHZ));
+}
@@ -0,0 +1,49 @@
+/******************************************************************************************
+  Filename    : Timebase.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Free-running timebase (SYSTIMER and CCOUNT) header file
+
+******************************************************************************************/
+
+#ifndef __TIMEBASE_H__
+#define __TIMEBASE_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define TIMEBASE_NUM_CORES          2ul
+
+/* SYSTIMER counter frequency (fixed, independent of the CPU clock) */
+#define TIMEBASE_SYSTIMER_MHZ       16ul
+
+/* compatibility accessor of the former 1us tick counter (no more periodic interrupt) */
+#define SysTickTimer1usBase         (Timebase_GetUs())
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+void Timebase_Init(void);
+uint64 Timebase_GetTicks(void);
+uint64 Timebase_GetUs(void);
+uint64 Timebase_GetNs(void);
+uint64 Timebase_GetCycles(void);
+uint64 Timebase_CyclesToNs(uint64 Cycles);
+uint32 Timebase_GetCpuMhz(void);
+void Timebase_DelayUs(uint32 Us);
+
+#endif
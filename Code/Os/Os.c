@@ -0,0 +1,784 @@
+/******************************************************************************************
+  Filename    : Os.c
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Preemptive priority scheduler for both cores. Each core has its own run
+                queues, tick (CCOMPARE1) and idle task. A task is only switched at the exit
+                of a level 1 interrupt: its context is the call_isr frame left on its stack,
+                and the software interrupt 7 is raised whenever a switch is needed.
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Os.h"
+#include "Irq.h"
+#include "Ipc.h"
+#include "Stack.h"
+#include "CpuTimer.h"
+#include "Timebase.h"
+#include "Spinlock.h"
+#include "core-isa.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* level 1 software interrupt requesting a task switch on its core */
+#define OS_SWITCH_CPU_INT         7ul
+
+#if (XCHAL_INT7_LEVEL != 1) || ((XCHAL_INTTYPE_MASK_SOFTWARE & (1ul << OS_SWITCH_CPU_INT)) == 0)
+  #error "the task switch needs CPU interrupt 7 as a level 1 software interrupt"
+#endif
+
+/* tick on the CPU timer 1 of each core */
+#define OS_TICK_TIMER             1ul
+#define OS_TICK_CPU_INT           XCHAL_TIMER1_INTERRUPT
+#define OS_TICK_LEVEL             XCHAL_INT15_LEVEL
+
+/* call_isr frame (FRAME_xxx in IntVectTable.s) */
+#define OS_FRAME_WORDS            36ul
+#define OS_FRAME_A0_IDX           0ul
+#define OS_FRAME_A2_IDX           1ul
+#define OS_FRAME_EPC_IDX          27ul
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define OS_RAISE_SWITCH()         __asm__ volatile ("wsr.intset %0\n\trsync" : : "r"(1ul << OS_SWITCH_CPU_INT) : "memory")
+#define OS_CLEAR_SWITCH()         __asm__ volatile ("wsr.intclear %0\n\trsync" : : "r"(1ul << OS_SWITCH_CPU_INT) : "memory")
+#define OS_WAITI()                __asm__ volatile ("waiti 0" : : : "memory")
+
+//=============================================================================
+// Types
+//=============================================================================
+typedef struct
+{
+  Os_TaskType*      pHead[OS_NUM_PRIORITIES];   /* ready tasks of each priority (FIFO) */
+  Os_TaskType*      pTail[OS_NUM_PRIORITIES];
+  uint32            ReadyMask;                  /* bit n: a task of priority n is queued */
+  Os_TaskType*      pDelayed;                   /* delayed tasks sorted by wake tick */
+  Os_TaskType*      pCurrent;
+  uint64            Tick;
+  boolean           Started;
+  boolean           Rotate;                     /* the running task goes behind its peers */
+  volatile boolean  SwitchRequest;
+  Os_TaskType       Idle;
+}Os_CoreType;
+
+//=============================================================================
+// Externs
+//=============================================================================
+extern uint32 get_core_id(void);
+
+extern unsigned long __CORE0_STACK_BOTTOM[];
+extern unsigned long __CORE0_STACK_TOP[];
+extern unsigned long __CORE1_STACK_BOTTOM[];
+extern unsigned long __CORE1_STACK_TOP[];
+
+//=============================================================================
+// Globals
+//=============================================================================
+
+/* note: one lock protects the queues of both cores (a task may be readied on the other core) */
+static Spinlock_Type Os_Lock = SPINLOCK_INIT;
+
+static Os_CoreType Os_Core[OS_NUM_CORES];
+
+//=============================================================================
+// Static functions
+//=============================================================================
+static void Os_TaskEntry(Os_TaskType* pTask) __attribute__((noreturn));
+static void Os_SwitchIsr(void* Arg);
+static void Os_TickIsr(void* Arg);
+static void Os_RemoteSwitch(void* Arg);
+static void Os_RequestSwitch(uint32 Core);
+static void Os_MakeReady(Os_TaskType* pTask, boolean Head);
+static uint32 Os_SelectCore(const Os_TaskType* pTask);
+static uint32 Os_GetLoad(const Os_CoreType* pCore);
+static void Os_Enqueue(Os_CoreType* pCore, Os_TaskType* pTask, boolean Head);
+static Os_TaskType* Os_Dequeue(Os_CoreType* pCore);
+static void Os_DelayInsert(Os_CoreType* pCore, Os_TaskType* pTask);
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_CreateTask function
+///
+/// \descr  Builds the first call_isr frame of the task at the top of its stack (the
+///         level 1 interrupt exit enters Os_TaskEntry) and readies it. Callable before
+///         Os_Start, from a task or from an interrupt handler.
+///
+/// \param  pTask     : task control block
+///         Entry     : task function (the task ends when it returns)
+///         Arg       : its argument
+///         Priority  : 1 .. OS_NUM_PRIORITIES - 1 (higher is more urgent)
+///         Affinity  : core 0, core 1 or OS_CORE_ANY
+///         pStack    : stack in the internal data RAM
+///         StackSize : stack size in bytes (at least OS_MIN_STACK_SIZE)
+///
+/// \return TRUE if the task is created
+//-----------------------------------------------------------------------------------------
+boolean Os_CreateTask(Os_TaskType* pTask, Os_TaskFuncType Entry, void* Arg, uint32 Priority, uint32 Affinity, uint32* pStack, uint32 StackSize)
+{
+  uint32* pFrame;
+  uint32 Top;
+  uint32 Ps;
+  uint32 i;
+
+  if((pTask == NULL) || (Entry == NULL) || (pStack == NULL) || (StackSize < OS_MIN_STACK_SIZE) ||
+     (Priority == OS_IDLE_PRIORITY) || (Priority >= OS_NUM_PRIORITIES) ||
+     ((Affinity >= OS_NUM_CORES) && (Affinity != OS_CORE_ANY)))
+  {
+    return(FALSE);
+  }
+
+  Top    = ((uint32)pStack + StackSize) & ~15ul;
+  pFrame = (uint32*)(Top - (OS_FRAME_WORDS * 4ul));
+
+  for(i = 0ul; i < OS_FRAME_WORDS; i++)
+  {
+    pFrame[i] = 0ul;
+  }
+
+  pFrame[OS_FRAME_A0_IDX]  = 0ul;
+  pFrame[OS_FRAME_A2_IDX]  = (uint32)pTask;
+  pFrame[OS_FRAME_EPC_IDX] = (uint32)Os_TaskEntry;
+
+  pTask->Frame       = (uint32)pFrame;
+  pTask->pNext       = NULL;
+  pTask->Entry       = Entry;
+  pTask->Arg         = Arg;
+  pTask->Priority    = Priority;
+  pTask->Affinity    = Affinity;
+  pTask->Notified    = FALSE;
+  pTask->WakeTick    = 0ull;
+  pTask->StackBottom = (uint32)pStack;
+  pTask->StackTop    = Top;
+  pTask->Switches    = 0ul;
+  pTask->Fpu.Fcr     = 0ul;
+  pTask->Fpu.Fsr     = 0ul;
+
+  Ps = Spinlock_LockIrqSave(&Os_Lock);
+  Os_MakeReady(pTask, FALSE);
+  Spinlock_UnlockIrqRestore(&Os_Lock, Ps);
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_Start function
+///
+/// \descr  Starts the scheduler on the calling core, called once by each core at the end
+///         of its main function. The caller becomes the idle task of the core (on the
+///         core stack) and sleeps in waiti until an interrupt readies a task.
+///
+/// \param  void
+///
+/// \return never
+//-----------------------------------------------------------------------------------------
+COLD_ATTR void Os_Start(void)
+{
+  const uint32 Core  = get_core_id();
+  Os_CoreType* pCore = &Os_Core[Core];
+  uint32 Ps;
+
+  pCore->Idle.Priority    = OS_IDLE_PRIORITY;
+  pCore->Idle.Affinity    = Core;
+  pCore->Idle.State       = OS_TASK_RUNNING;
+  pCore->Idle.StackBottom = (Core == 0ul) ? (uint32)&__CORE0_STACK_BOTTOM[0] : (uint32)&__CORE1_STACK_BOTTOM[0];
+  pCore->Idle.StackTop    = (Core == 0ul) ? (uint32)&__CORE0_STACK_TOP[0]    : (uint32)&__CORE1_STACK_TOP[0];
+
+  (void)Irq_Register(Core, OS_SWITCH_CPU_INT, 1ul, Os_SwitchIsr, NULL);
+  (void)Irq_Register(Core, OS_TICK_CPU_INT, OS_TICK_LEVEL, Os_TickIsr, NULL);
+
+  Ps = Spinlock_LockIrqSave(&Os_Lock);
+
+  pCore->pCurrent = &pCore->Idle;
+  pCore->Started  = TRUE;
+
+  /* tasks created before the start are waiting in the queues */
+  Os_RequestSwitch(Core);
+
+  Spinlock_UnlockIrqRestore(&Os_Lock, Ps);
+
+  Irq_Enable(OS_TICK_CPU_INT);
+  (void)CpuTimer_StartPeriodic(OS_TICK_TIMER, (Timebase_GetCpuMhz() * 1000000ul) / OS_TICK_HZ, CPU_TIMER_CATCHUP_SKIP);
+
+  Irq_Enable(OS_SWITCH_CPU_INT);
+
+  for(;;)
+  {
+    OS_WAITI();
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_Delay function
+///
+/// \descr  Blocks the running task for a number of ticks of its core (task level only).
+///
+/// \param  Ticks : delay in ticks (0: yield to the ready tasks of the same priority)
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void Os_Delay(uint32 Ticks)
+{
+  const uint32 Core  = get_core_id();
+  Os_CoreType* pCore = &Os_Core[Core];
+  Os_TaskType* pTask;
+  uint32 Ps;
+
+  Ps = Spinlock_LockIrqSave(&Os_Lock);
+
+  pTask = pCore->pCurrent;
+
+  if((pCore->Started == TRUE) && (pTask != &pCore->Idle))
+  {
+    if(Ticks == 0ul)
+    {
+      pCore->Rotate = TRUE;
+    }
+    else
+    {
+      pTask->WakeTick = pCore->Tick + Ticks;
+      pTask->State    = OS_TASK_DELAYED;
+      Os_DelayInsert(pCore, pTask);
+    }
+
+    Os_RequestSwitch(Core);
+  }
+
+  /* the switch interrupt is taken as soon as the interrupts are unmasked */
+  Spinlock_UnlockIrqRestore(&Os_Lock, Ps);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_Yield function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void Os_Yield(void)
+{
+  Os_Delay(0ul);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_Wait function
+///
+/// \descr  Blocks the running task until Os_Notify. A notification sent while the task
+///         was not waiting is kept, the next Os_Wait returns at once.
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void Os_Wait(void)
+{
+  const uint32 Core  = get_core_id();
+  Os_CoreType* pCore = &Os_Core[Core];
+  Os_TaskType* pTask;
+  uint32 Ps;
+
+  Ps = Spinlock_LockIrqSave(&Os_Lock);
+
+  pTask = pCore->pCurrent;
+
+  if(pTask->Notified == TRUE)
+  {
+    pTask->Notified = FALSE;
+  }
+  else if((pCore->Started == TRUE) && (pTask != &pCore->Idle))
+  {
+    pTask->State = OS_TASK_WAITING;
+    Os_RequestSwitch(Core);
+  }
+  else
+  {
+    /* nothing to block before the start or in the idle task */
+  }
+
+  Spinlock_UnlockIrqRestore(&Os_Lock, Ps);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_Notify function
+///
+/// \descr  Readies a task blocked in Os_Wait. Callable from a task or from an interrupt
+///         handler of either core (up to level 5).
+///
+/// \param  pTask : task to notify
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR void Os_Notify(Os_TaskType* pTask)
+{
+  uint32 Ps;
+
+  Ps = Spinlock_LockIrqSave(&Os_Lock);
+
+  if(pTask->State == OS_TASK_WAITING)
+  {
+    Os_MakeReady(pTask, FALSE);
+  }
+  else if(pTask->State != OS_TASK_TERMINATED)
+  {
+    pTask->Notified = TRUE;
+  }
+  else
+  {
+    /* a terminated task is not notified */
+  }
+
+  Spinlock_UnlockIrqRestore(&Os_Lock, Ps);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_Exit function
+///
+/// \descr  Terminates the running task, its control block and stack may be reused after.
+///
+/// \param  void
+///
+/// \return never
+//-----------------------------------------------------------------------------------------
+void Os_Exit(void)
+{
+  const uint32 Core = get_core_id();
+  uint32 Ps;
+
+  Ps = Spinlock_LockIrqSave(&Os_Lock);
+
+  Os_Core[Core].pCurrent->State = OS_TASK_TERMINATED;
+
+  /* the FPU of the core must not save into the control block once it is reused */
+  Fpu_DropContext(&Os_Core[Core].pCurrent->Fpu);
+  Os_RequestSwitch(Core);
+
+  Spinlock_UnlockIrqRestore(&Os_Lock, Ps);
+
+  for(;;);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_GetCurrentTask function
+///
+/// \param  void
+///
+/// \return task running on the calling core (its idle task when none is ready)
+//-----------------------------------------------------------------------------------------
+Os_TaskType* Os_GetCurrentTask(void)
+{
+  return(Os_Core[get_core_id()].pCurrent);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_GetTicks function
+///
+/// \param  void
+///
+/// \return ticks of the calling core since its Os_Start
+//-----------------------------------------------------------------------------------------
+uint64 Os_GetTicks(void)
+{
+  uint64 Tick;
+  uint32 Ps;
+
+  Ps = Spinlock_LockIrqSave(&Os_Lock);
+  Tick = Os_Core[get_core_id()].Tick;
+  Spinlock_UnlockIrqRestore(&Os_Lock, Ps);
+
+  return(Tick);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_SwitchFrame function
+///
+/// \descr  Called by call_isr at the exit of each level 1 interrupt, after the FPU state
+///         of the handler is given back and with PS.EXCM set. The level 1 interrupts only
+///         preempt the thread level, so Frame is the complete context of the running
+///         task. When a switch is pending, the highest ready task of the core is chosen
+///         and call_isr restores its frame instead.
+///
+/// \param  Frame : call_isr frame of the interrupted task
+///
+/// \return frame to restore (Frame when the task keeps running)
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR uint32 Os_SwitchFrame(uint32 Frame)
+{
+  const uint32 Core  = get_core_id();
+  Os_CoreType* pCore = &Os_Core[Core];
+  Os_TaskType* pPrev;
+  Os_TaskType* pNext;
+  uint32 Best;
+  uint32 Ps;
+
+  if(pCore->SwitchRequest == FALSE)
+  {
+    return(Frame);
+  }
+
+  Ps = Spinlock_LockIrqSave(&Os_Lock);
+
+  pCore->SwitchRequest = FALSE;
+  pPrev = pCore->pCurrent;
+
+  if(pPrev->State == OS_TASK_RUNNING)
+  {
+    Best = (pCore->ReadyMask != 0ul) ? (31ul - (uint32)__builtin_clz(pCore->ReadyMask)) : 0ul;
+
+    if((pCore->ReadyMask == 0ul) || (Best < pPrev->Priority) || ((Best == pPrev->Priority) && (pCore->Rotate == FALSE)))
+    {
+      pCore->Rotate = FALSE;
+      Spinlock_UnlockIrqRestore(&Os_Lock, Ps);
+      return(Frame);
+    }
+
+    /* preempted: first of its priority again, rotated: behind its peers */
+    pPrev->State = OS_TASK_READY;
+    Os_Enqueue(pCore, pPrev, (Best > pPrev->Priority) ? TRUE : FALSE);
+  }
+
+  pCore->Rotate = FALSE;
+
+  pPrev->Frame = Frame;
+
+  pNext = Os_Dequeue(pCore);
+  pNext->State    = OS_TASK_RUNNING;
+  pCore->pCurrent = pNext;
+
+  if(pNext != pPrev)
+  {
+    pNext->Switches++;
+
+    /* a task without affinity may be dequeued by the other core as soon as the lock
+       is released, its FP state cannot stay in the FPU of this core */
+    if(pPrev->Affinity == OS_CORE_ANY)
+    {
+      Fpu_FlushContext(&pPrev->Fpu);
+    }
+
+    /* the FP registers follow lazily, the stack guard is moved by Os_SwitchDone */
+    Fpu_SwitchContext(&pNext->Fpu);
+    Stack_SuspendGuard();
+  }
+
+  Spinlock_UnlockIrqRestore(&Os_Lock, Ps);
+
+  return(pNext->Frame);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_SwitchDone function
+///
+/// \descr  Called by call_isr once SP is on the stack of the new task.
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR void Os_SwitchDone(void)
+{
+  const Os_TaskType* pTask = Os_Core[get_core_id()].pCurrent;
+
+  Stack_SetGuard(pTask->StackBottom, pTask->StackTop);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_TaskEntry function
+///
+/// \param  pTask : task started by its first frame (a2)
+///
+/// \return never
+//-----------------------------------------------------------------------------------------
+static void Os_TaskEntry(Os_TaskType* pTask)
+{
+  pTask->Entry(pTask->Arg);
+
+  Os_Exit();
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_SwitchIsr function
+///
+/// \descr  Software interrupt 7: only acknowledged here, the switch itself is done by
+///         call_isr after the dispatch (Os_SwitchFrame).
+///
+/// \param  Arg : unused
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void Os_SwitchIsr(void* Arg)
+{
+  (void)Arg;
+
+  OS_CLEAR_SWITCH();
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_TickIsr function
+///
+/// \descr  Tick of a core: wakes the delayed tasks that are due and rotates the running
+///         task behind the ready tasks of its priority (time slice of one tick). It also
+///         reads the 64-bit cycle count, so that its CCOUNT wrap is never missed on the core.
+///
+/// \param  Arg : unused
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void Os_TickIsr(void* Arg)
+{
+  const uint32 Core  = get_core_id();
+  Os_CoreType* pCore = &Os_Core[Core];
+  const uint32 Missed = CpuTimer_Rearm(OS_TICK_TIMER);
+  Os_TaskType* pTask;
+  uint32 Ps;
+
+  (void)Arg;
+
+  (void)Timebase_GetCycles();
+
+  Ps = Spinlock_LockIrqSave(&Os_Lock);
+
+  pCore->Tick += 1ul + Missed;
+
+  while((pCore->pDelayed != NULL) && (pCore->pDelayed->WakeTick <= pCore->Tick))
+  {
+    pTask = pCore->pDelayed;
+    pCore->pDelayed = pTask->pNext;
+
+    Os_MakeReady(pTask, FALSE);
+  }
+
+  if((pCore->ReadyMask & (1ul << pCore->pCurrent->Priority)) != 0ul)
+  {
+    pCore->Rotate = TRUE;
+    Os_RequestSwitch(Core);
+  }
+  else if(pCore->SwitchRequest == TRUE)
+  {
+    /* request of the other core whose IPC call was dropped (ring full) */
+    OS_RAISE_SWITCH();
+  }
+  else
+  {
+    /* the running task keeps the core */
+  }
+
+  Spinlock_UnlockIrqRestore(&Os_Lock, Ps);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_RemoteSwitch function
+///
+/// \param  Arg : unused
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void Os_RemoteSwitch(void* Arg)
+{
+  (void)Arg;
+
+  OS_RAISE_SWITCH();
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_RequestSwitch function
+///
+/// \descr  Raises the switch interrupt of a core, through an IPC call for the other
+///         core (Os_Lock held).
+///
+/// \param  Core : 0 or 1
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void Os_RequestSwitch(uint32 Core)
+{
+  Os_Core[Core].SwitchRequest = TRUE;
+
+  if(Core == get_core_id())
+  {
+    OS_RAISE_SWITCH();
+  }
+  else
+  {
+    (void)Ipc_Post(Core, Os_RemoteSwitch, NULL);
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_MakeReady function
+///
+/// \param  pTask : task to queue (Os_Lock held)
+///         Head  : TRUE to queue it first of its priority
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void Os_MakeReady(Os_TaskType* pTask, boolean Head)
+{
+  const uint32 Core  = Os_SelectCore(pTask);
+  Os_CoreType* pCore = &Os_Core[Core];
+
+  pTask->State = OS_TASK_READY;
+  Os_Enqueue(pCore, pTask, Head);
+
+  if((pCore->Started == TRUE) && (pCore->pCurrent != pTask) && (pTask->Priority > pCore->pCurrent->Priority))
+  {
+    Os_RequestSwitch(Core);
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_SelectCore function
+///
+/// \descr  A task still on a core (blocked but not switched out yet) stays there, its
+///         frame is not saved. Otherwise a task without affinity goes to the started core
+///         whose highest running or queued priority is the lower, the calling core on a tie.
+///
+/// \param  pTask : task to queue
+///
+/// \return core of the run queue
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR uint32 Os_SelectCore(const Os_TaskType* pTask)
+{
+  const uint32 Self  = get_core_id();
+  const uint32 Other = Self ^ 1ul;
+
+  if(Os_Core[Self].pCurrent == pTask)
+  {
+    return(Self);
+  }
+
+  if(Os_Core[Other].pCurrent == pTask)
+  {
+    return(Other);
+  }
+
+  if(pTask->Affinity < OS_NUM_CORES)
+  {
+    return(pTask->Affinity);
+  }
+
+  if(Os_Core[Other].Started == FALSE)
+  {
+    return(Self);
+  }
+
+  if(Os_Core[Self].Started == FALSE)
+  {
+    return(Other);
+  }
+
+  return((Os_GetLoad(&Os_Core[Other]) < Os_GetLoad(&Os_Core[Self])) ? Other : Self);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_GetLoad function
+///
+/// \param  pCore : started core (Os_Lock held)
+///
+/// \return highest priority running or queued on the core
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR uint32 Os_GetLoad(const Os_CoreType* pCore)
+{
+  const uint32 Queued = (pCore->ReadyMask != 0ul) ? (31ul - (uint32)__builtin_clz(pCore->ReadyMask)) : 0ul;
+
+  return((Queued > pCore->pCurrent->Priority) ? Queued : pCore->pCurrent->Priority);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_Enqueue function
+///
+/// \param  pCore : core of the run queue (Os_Lock held)
+///         pTask : ready task
+///         Head  : TRUE to queue it first of its priority
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void Os_Enqueue(Os_CoreType* pCore, Os_TaskType* pTask, boolean Head)
+{
+  const uint32 Priority = pTask->Priority;
+
+  pTask->pNext = NULL;
+
+  if(pCore->pHead[Priority] == NULL)
+  {
+    pCore->pHead[Priority] = pTask;
+    pCore->pTail[Priority] = pTask;
+  }
+  else if(Head == TRUE)
+  {
+    pTask->pNext = pCore->pHead[Priority];
+    pCore->pHead[Priority] = pTask;
+  }
+  else
+  {
+    pCore->pTail[Priority]->pNext = pTask;
+    pCore->pTail[Priority] = pTask;
+  }
+
+  pCore->ReadyMask |= (1ul << Priority);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_Dequeue function
+///
+/// \param  pCore : core of the run queue (Os_Lock held)
+///
+/// \return first task of the highest ready priority (the idle task when none is queued)
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR Os_TaskType* Os_Dequeue(Os_CoreType* pCore)
+{
+  uint32 Priority;
+  Os_TaskType* pTask;
+
+  if(pCore->ReadyMask == 0ul)
+  {
+    return(&pCore->Idle);
+  }
+
+  Priority = 31ul - (uint32)__builtin_clz(pCore->ReadyMask);
+  pTask    = pCore->pHead[Priority];
+
+  pCore->pHead[Priority] = pTask->pNext;
+
+  if(pCore->pHead[Priority] == NULL)
+  {
+    pCore->ReadyMask &= ~(1ul << Priority);
+  }
+
+  pTask->pNext = NULL;
+
+  return(pTask);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Os_DelayInsert function
+///
+/// \param  pCore : core of the delay list (Os_Lock held)
+///         pTask : task with its WakeTick set (behind the tasks due at the same tick)
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Os_DelayInsert(Os_CoreType* pCore, Os_TaskType* pTask)
+{
+  Os_TaskType** ppLink = &pCore->pDelayed;
+
+  while((*ppLink != NULL) && ((*ppLink)->WakeTick <= pTask->WakeTick))
+  {
+    ppLink = &(*ppLink)->pNext;
+  }
+
+  pTask->pNext = *ppLink;
+  *ppLink = pTask;
+}
@@ -0,0 +1,97 @@
+/******************************************************************************************
+  Filename    : Os.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Preemptive priority scheduler for both cores header file
+
+******************************************************************************************/
+
+#ifndef __OS_H__
+#define __OS_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+#include "Fpu.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define OS_NUM_CORES              2ul
+
+/* priorities 1 (lowest) .. 31, priority 0 is the idle task of each core */
+#define OS_NUM_PRIORITIES         32ul
+#define OS_IDLE_PRIORITY          0ul
+
+/* affinity argument of Os_CreateTask: the task runs on the least busy core */
+#define OS_CORE_ANY               0xFFul
+
+/* smallest task stack (the interrupt frames and the stack guard band live on it too) */
+#define OS_MIN_STACK_SIZE         1024ul
+
+#ifndef OS_TICK_HZ
+  #define OS_TICK_HZ              1000ul
+#endif
+
+#define OS_MS_TO_TICKS(ms)        ((((uint32)(ms)) * OS_TICK_HZ) / 1000ul)
+
+//=============================================================================
+// Types
+//=============================================================================
+typedef void (*Os_TaskFuncType)(void* Arg);
+
+typedef enum
+{
+  OS_TASK_READY = 0,
+  OS_TASK_RUNNING,
+  OS_TASK_DELAYED,
+  OS_TASK_WAITING,
+  OS_TASK_TERMINATED
+}Os_TaskStateType;
+
+/* task control block owned by the user (must stay valid while the task exists) */
+typedef struct Os_Task
+{
+  uint32            Frame;          /* call_isr frame of the switched out task (its SP) */
+  struct Os_Task*   pNext;          /* run queue or delay list link */
+  Os_TaskFuncType   Entry;
+  void*             Arg;
+  uint32            Priority;
+  uint32            Affinity;       /* 0, 1 or OS_CORE_ANY */
+  Os_TaskStateType  State;
+  boolean           Notified;
+  uint64            WakeTick;
+  uint32            StackBottom;
+  uint32            StackTop;
+  uint32            Switches;       /* number of times the task was switched in */
+  Fpu_ContextType   Fpu;
+}Os_TaskType;
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+boolean Os_CreateTask(Os_TaskType* pTask, Os_TaskFuncType Entry, void* Arg, uint32 Priority, uint32 Affinity, uint32* pStack, uint32 StackSize);
+void Os_Start(void) __attribute__((noreturn));
+void Os_Delay(uint32 Ticks);
+void Os_Yield(void);
+void Os_Wait(void);
+void Os_Notify(Os_TaskType* pTask);
+void Os_Exit(void) __attribute__((noreturn));
+Os_TaskType* Os_GetCurrentTask(void);
+uint64 Os_GetTicks(void);
+
+/* called by call_isr at the exit of the level 1 interrupts (IntVectTable.s) */
+uint32 Os_SwitchFrame(uint32 Frame);
+void Os_SwitchDone(void);
+
+#endif
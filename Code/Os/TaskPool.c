@@ -0,0 +1,574 @@
+/******************************************************************************************
+  Filename    : TaskPool.c
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Fork/join task pool with work stealing between both cores. Each core owns a
+                bounded Chase-Lev deque: the tasks of that core push and pop jobs at its
+                bottom, the other core steals the oldest job at its top with a CAS. A worker
+                task pinned to each core runs or steals jobs, and sleeps in Os_Wait when
+                both deques are empty (woken through the cross-core interrupt by Os_Notify).
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "TaskPool.h"
+#include "Atomic.h"
+
+#if (TASKPOOL_DEQUE_SIZE & (TASKPOOL_DEQUE_SIZE - 1ul)) != 0ul
+  #error "TASKPOOL_DEQUE_SIZE must be a power of two"
+#endif
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* flag of TaskPool_GroupType.Pending: the joiner waits for the last job in Os_Wait */
+#define TASKPOOL_JOIN_WAITING       0x80000000ul
+#define TASKPOOL_JOIN_COUNT_MASK    (~TASKPOOL_JOIN_WAITING)
+
+//=============================================================================
+// Macros
+//=============================================================================
+
+/* the owner side of a deque runs with the level 1 interrupts masked: no task switch
+   (they only happen at the exit of a level 1 interrupt), so no other task of the core
+   and no migration of the caller can interleave with it */
+#define TASKPOOL_IRQ_SAVE(ps)       __asm__ volatile ("rsil %0, 1" : "=r"(ps) : : "memory")
+#define TASKPOOL_IRQ_RESTORE(ps)    __asm__ volatile ("wsr.ps %0\n\trsync" : : "r"(ps) : "memory")
+
+//=============================================================================
+// Types
+//=============================================================================
+typedef struct
+{
+  volatile uint32             Top    __attribute__((aligned(TASKPOOL_ALIGN)));   /* oldest job (thieves) */
+  volatile uint32             Bottom __attribute__((aligned(TASKPOOL_ALIGN)));   /* next free slot (owner core) */
+  TaskPool_JobType* volatile  Slot[TASKPOOL_DEQUE_SIZE];
+}TaskPool_DequeType;
+
+/* one range of a TaskPool_ParallelFor */
+typedef struct
+{
+  TaskPool_JobType        Job;
+  TaskPool_RangeFuncType  Func;
+  void*                   Arg;
+  uint32                  Begin;
+  uint32                  End;
+}TaskPool_ChunkType;
+
+//=============================================================================
+// Externs
+//=============================================================================
+extern uint32 get_core_id(void);
+
+//=============================================================================
+// Globals
+//=============================================================================
+static TaskPool_DequeType TaskPool_Deque[OS_NUM_CORES];
+
+static Os_TaskType TaskPool_Worker[OS_NUM_CORES];
+static uint32 TaskPool_WorkerStack[OS_NUM_CORES][TASKPOOL_WORKER_STACK_SIZE / sizeof(uint32)];
+
+/* the worker of the core is (about to be) blocked in Os_Wait */
+static volatile uint32 TaskPool_Sleeping[OS_NUM_CORES];
+
+/* jobs taken from the deque of the other core, per thief core */
+static volatile uint32 TaskPool_Steals[OS_NUM_CORES];
+
+//=============================================================================
+// Static functions
+//=============================================================================
+static void TaskPool_WorkerTask(void* Arg);
+static boolean TaskPool_Push(TaskPool_JobType* pJob);
+static TaskPool_JobType* TaskPool_Pop(void);
+static TaskPool_JobType* TaskPool_Steal(uint32 Victim);
+static boolean TaskPool_RunOne(void);
+static void TaskPool_Run(TaskPool_JobType* pJob);
+static void TaskPool_Sleep(TaskPool_GroupType* pGroup);
+static boolean TaskPool_HasWork(void);
+static void TaskPool_RunChunk(void* Arg);
+
+//-----------------------------------------------------------------------------------------
+/// \brief  TaskPool_Init function
+///
+/// \descr  Creates the worker task of each core. Called once before Os_Start.
+///
+/// \param  Priority : priority of the workers
+///
+/// \return TRUE if both workers are created
+//-----------------------------------------------------------------------------------------
+COLD_ATTR boolean TaskPool_Init(uint32 Priority)
+{
+  uint32 Core;
+
+  for(Core = 0ul; Core < OS_NUM_CORES; Core++)
+  {
+    if(Os_CreateTask(&TaskPool_Worker[Core], TaskPool_WorkerTask, (void*)Core, Priority, Core,
+                     TaskPool_WorkerStack[Core], TASKPOOL_WORKER_STACK_SIZE) == FALSE)
+    {
+      return(FALSE);
+    }
+  }
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  TaskPool_GroupInit function
+///
+/// \param  pGroup : group without pending jobs
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void TaskPool_GroupInit(TaskPool_GroupType* pGroup)
+{
+  pGroup->Pending = 0ul;
+  pGroup->pJoiner = NULL;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  TaskPool_Spawn function
+///
+/// \descr  Queues Func(Arg) on the deque of the calling core (task level, either core)
+///         and wakes the worker of the other core to steal it. The job runs at once in
+///         the caller when the deque is full.
+///
+/// \param  pGroup : group joined by the caller
+///         pJob   : job storage (valid until the group is joined)
+///         Func   : job function
+///         Arg    : its argument
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR void TaskPool_Spawn(TaskPool_GroupType* pGroup, TaskPool_JobType* pJob, TaskPool_FuncType Func, void* Arg)
+{
+  uint32 Other;
+
+  pJob->Func   = Func;
+  pJob->Arg    = Arg;
+  pJob->pGroup = pGroup;
+
+  (void)Atomic_FetchAdd(&pGroup->Pending, 1ul);
+
+  if(TaskPool_Push(pJob) == FALSE)
+  {
+    TaskPool_Run(pJob);
+    return;
+  }
+
+  /* pairs with the barrier of the worker between its sleeping flag and its last look */
+  ATOMIC_BARRIER();
+
+  Other = get_core_id() ^ 1ul;
+
+  if(Atomic_LoadAcquire(&TaskPool_Sleeping[Other]) != 0ul)
+  {
+    Os_Notify(&TaskPool_Worker[Other]);
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  TaskPool_Join function
+///
+/// \descr  Runs the queued jobs (its own first, then stolen ones) until every job of the
+///         group is done. With nothing left to run, the caller blocks in Os_Wait while
+///         the last jobs run elsewhere, and the job that completes the group wakes it.
+///
+/// \param  pGroup : group to join
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR void TaskPool_Join(TaskPool_GroupType* pGroup)
+{
+  while((Atomic_LoadAcquire(&pGroup->Pending) & TASKPOOL_JOIN_COUNT_MASK) != 0ul)
+  {
+    if(TaskPool_RunOne() == FALSE)
+    {
+      TaskPool_Sleep(pGroup);
+    }
+  }
+
+  /* the last job no longer accesses the group, it may be spawned into again */
+  Atomic_StoreRelease(&pGroup->Pending, 0ul);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  TaskPool_ParallelFor function
+///
+/// \descr  Calls Func on consecutive ranges covering [Begin, End) of Grain indexes (more
+///         when TASKPOOL_FOR_MAX_CHUNKS ranges would not cover it, the last one may be
+///         shorter). The caller spawns the ranges but the first, runs that one, and
+///         returns when all of them are done (task level).
+///
+/// \param  Begin : first index
+///         End   : index after the last one
+///         Grain : smallest range worth a job
+///         Func  : range function
+///         Arg   : its argument
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void TaskPool_ParallelFor(uint32 Begin, uint32 End, uint32 Grain, TaskPool_RangeFuncType Func, void* Arg)
+{
+  TaskPool_ChunkType Chunk[TASKPOOL_FOR_MAX_CHUNKS];
+  TaskPool_GroupType Group;
+  uint32 Count;
+  uint32 Size;
+  uint32 Chunks;
+  uint32 i;
+
+  if(End <= Begin)
+  {
+    return;
+  }
+
+  Count  = End - Begin;
+  Size   = (Count + TASKPOOL_FOR_MAX_CHUNKS - 1ul) / TASKPOOL_FOR_MAX_CHUNKS;
+  Size   = (Size > Grain) ? Size : ((Grain == 0ul) ? 1ul : Grain);
+  Chunks = (Count + Size - 1ul) / Size;
+
+  TaskPool_GroupInit(&Group);
+
+  for(i = 0ul; i < Chunks; i++)
+  {
+    Chunk[i].Func  = Func;
+    Chunk[i].Arg   = Arg;
+    Chunk[i].Begin = Begin + (i * Size);
+    Chunk[i].End   = ((Count - (i * Size)) > Size) ? (Chunk[i].Begin + Size) : End;
+
+    if(i != 0ul)
+    {
+      TaskPool_Spawn(&Group, &Chunk[i].Job, TaskPool_RunChunk, &Chunk[i]);
+    }
+  }
+
+  Func(Chunk[0].Begin, Chunk[0].End, Arg);
+
+  TaskPool_Join(&Group);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  TaskPool_GetSteals function
+///
+/// \param  Core : thief core
+///
+/// \return number of jobs the core took from the deque of the other core
+//-----------------------------------------------------------------------------------------
+uint32 TaskPool_GetSteals(uint32 Core)
+{
+  return((Core < OS_NUM_CORES) ? TaskPool_Steals[Core] : 0ul);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  TaskPool_WorkerTask function
+///
+/// \descr  Runs jobs while there are any. Before sleeping, the worker publishes its
+///         sleeping flag and looks at the deques once more, so a job pushed meanwhile
+///         either is seen here or its spawner sees the flag (a notification sent
+///         before Os_Wait is kept).
+///
+/// \param  Arg : core of the worker
+///
+/// \return never
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void TaskPool_WorkerTask(void* Arg)
+{
+  const uint32 Core = (uint32)Arg;
+
+  for(;;)
+  {
+    if(TaskPool_RunOne() == FALSE)
+    {
+      Atomic_StoreRelease(&TaskPool_Sleeping[Core], 1ul);
+
+      ATOMIC_BARRIER();
+
+      if(TaskPool_HasWork() == FALSE)
+      {
+        Os_Wait();
+      }
+
+      Atomic_StoreRelease(&TaskPool_Sleeping[Core], 0ul);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  TaskPool_Push function
+///
+/// \param  pJob : job queued at the bottom of the deque of the calling core
+///
+/// \return TRUE if queued, FALSE if the deque is full
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR boolean TaskPool_Push(TaskPool_JobType* pJob)
+{
+  TaskPool_DequeType* pDeque;
+  boolean Result = FALSE;
+  uint32 Bottom;
+  uint32 Top;
+  uint32 Ps;
+
+  TASKPOOL_IRQ_SAVE(Ps);
+
+  pDeque = &TaskPool_Deque[get_core_id()];
+  Bottom = pDeque->Bottom;
+  Top    = Atomic_LoadAcquire(&pDeque->Top);
+
+  /* a stale top only makes the deque look fuller */
+  if((Bottom - Top) < TASKPOOL_DEQUE_SIZE)
+  {
+    pDeque->Slot[Bottom & (TASKPOOL_DEQUE_SIZE - 1ul)] = pJob;
+
+    Atomic_StoreRelease(&pDeque->Bottom, Bottom + 1ul);
+
+    Result = TRUE;
+  }
+
+  TASKPOOL_IRQ_RESTORE(Ps);
+
+  return(Result);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  TaskPool_Pop function
+///
+/// \descr  Takes the newest job of the deque of the calling core. The bottom is lowered
+///         before the top is read (full barrier), so a thief and the owner can only meet
+///         on the last job, which they race for with a CAS on the top.
+///
+/// \param  void
+///
+/// \return job, NULL if the deque is empty
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR TaskPool_JobType* TaskPool_Pop(void)
+{
+  TaskPool_DequeType* pDeque;
+  TaskPool_JobType* pJob = NULL;
+  uint32 Bottom;
+  uint32 Top;
+  uint32 Ps;
+
+  TASKPOOL_IRQ_SAVE(Ps);
+
+  pDeque = &TaskPool_Deque[get_core_id()];
+  Bottom = pDeque->Bottom - 1ul;
+
+  Atomic_StoreRelease(&pDeque->Bottom, Bottom);
+
+  ATOMIC_BARRIER();
+
+  Top = Atomic_LoadAcquire(&pDeque->Top);
+
+  if((sint32)(Bottom - Top) < 0)
+  {
+    /* empty */
+    Atomic_StoreRelease(&pDeque->Bottom, Bottom + 1ul);
+  }
+  else
+  {
+    pJob = pDeque->Slot[Bottom & (TASKPOOL_DEQUE_SIZE - 1ul)];
+
+    if(Bottom == Top)
+    {
+      if(Atomic_CompareExchange(&pDeque->Top, Top, Top + 1ul) != Top)
+      {
+        /* stolen meanwhile */
+        pJob = NULL;
+      }
+
+      Atomic_StoreRelease(&pDeque->Bottom, Top + 1ul);
+    }
+  }
+
+  TASKPOOL_IRQ_RESTORE(Ps);
+
+  return(pJob);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  TaskPool_Steal function
+///
+/// \param  Victim : core of the deque
+///
+/// \return its oldest job, NULL if empty or lost to another thief or to the owner
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR TaskPool_JobType* TaskPool_Steal(uint32 Victim)
+{
+  TaskPool_DequeType* pDeque = &TaskPool_Deque[Victim];
+  TaskPool_JobType* pJob;
+  uint32 Bottom;
+  uint32 Top;
+
+  Top = Atomic_LoadAcquire(&pDeque->Top);
+
+  ATOMIC_BARRIER();
+
+  Bottom = Atomic_LoadAcquire(&pDeque->Bottom);
+
+  if((sint32)(Bottom - Top) <= 0)
+  {
+    return(NULL);
+  }
+
+  /* the slot is only reused by the owner once the top has moved, then the CAS fails */
+  pJob = pDeque->Slot[Top & (TASKPOOL_DEQUE_SIZE - 1ul)];
+
+  if(Atomic_CompareExchange(&pDeque->Top, Top, Top + 1ul) != Top)
+  {
+    return(NULL);
+  }
+
+  (void)Atomic_FetchAdd(&TaskPool_Steals[get_core_id()], 1ul);
+
+  return(pJob);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  TaskPool_RunOne function
+///
+/// \param  void
+///
+/// \return TRUE if a job of the calling core or of the other core was run
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR boolean TaskPool_RunOne(void)
+{
+  TaskPool_JobType* pJob = TaskPool_Pop();
+
+  if(pJob == NULL)
+  {
+    pJob = TaskPool_Steal(get_core_id() ^ 1ul);
+  }
+
+  if(pJob == NULL)
+  {
+    return(FALSE);
+  }
+
+  TaskPool_Run(pJob);
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  TaskPool_Run function
+///
+/// \descr  The joiner is read before the count is decremented: the group and the job
+///         may be released as soon as the count reaches 0.
+///
+/// \param  pJob : job to run (not accessed after its group is released)
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void TaskPool_Run(TaskPool_JobType* pJob)
+{
+  TaskPool_GroupType* pGroup = pJob->pGroup;
+  Os_TaskType* pJoiner;
+  uint32 Pending;
+  uint32 Seen;
+
+  pJob->Func(pJob->Arg);
+
+  /* the compare-exchange barriers publish the results of the job to the joiner, the
+     waiting flag is set after pJoiner (see TaskPool_Sleep) */
+  Pending = Atomic_LoadAcquire(&pGroup->Pending);
+  pJoiner = pGroup->pJoiner;
+
+  while((Seen = Atomic_CompareExchange(&pGroup->Pending, Pending, Pending - 1ul)) != Pending)
+  {
+    Pending = Seen;
+    pJoiner = pGroup->pJoiner;
+  }
+
+  if(Pending == (TASKPOOL_JOIN_WAITING | 1ul))
+  {
+    Os_Notify(pJoiner);
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  TaskPool_Sleep function
+///
+/// \descr  Blocks the joiner until the last job of the group is done. The waiting flag
+///         is only set while jobs are pending, so their last one notifies the joiner
+///         (a notification sent before Os_Wait is kept). Before Os_Start or in the idle
+///         task, Os_Wait returns at once and the joiner keeps polling.
+///
+/// \param  pGroup : group joined by the calling task
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void TaskPool_Sleep(TaskPool_GroupType* pGroup)
+{
+  Os_TaskType* const pTask = Os_GetCurrentTask();
+  uint32 Pending;
+  uint32 Seen;
+
+  if(pTask == NULL)
+  {
+    return;
+  }
+
+  pGroup->pJoiner = pTask;
+
+  Pending = Atomic_LoadAcquire(&pGroup->Pending);
+
+  while((Pending & TASKPOOL_JOIN_COUNT_MASK) != 0ul)
+  {
+    Seen = Atomic_CompareExchange(&pGroup->Pending, Pending, Pending | TASKPOOL_JOIN_WAITING);
+
+    if(Seen == Pending)
+    {
+      Os_Wait();
+      return;
+    }
+
+    Pending = Seen;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  TaskPool_HasWork function
+///
+/// \param  void
+///
+/// \return TRUE if a deque holds a job
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR boolean TaskPool_HasWork(void)
+{
+  uint32 Core;
+
+  for(Core = 0ul; Core < OS_NUM_CORES; Core++)
+  {
+    if((sint32)(Atomic_LoadAcquire(&TaskPool_Deque[Core].Bottom) - Atomic_LoadAcquire(&TaskPool_Deque[Core].Top)) > 0)
+    {
+      return(TRUE);
+    }
+  }
+
+  return(FALSE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  TaskPool_RunChunk function
+///
+/// \param  Arg : range of a TaskPool_ParallelFor (TaskPool_ChunkType)
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void TaskPool_RunChunk(void* Arg)
+{
+  const TaskPool_ChunkType* pChunk = (const TaskPool_ChunkType*)Arg;
+
+  pChunk->Func(pChunk->Begin, pChunk->End, pChunk->Arg);
+}
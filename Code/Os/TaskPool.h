@@ -0,0 +1,79 @@
+/******************************************************************************************
+  Filename    : TaskPool.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Fork/join task pool with work stealing between both cores header file
+
+******************************************************************************************/
+
+#ifndef __TASK_POOL_H__
+#define __TASK_POOL_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+#include "core-isa.h"
+#include "Os.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* jobs queued per core (power of two), a spawn on a full deque runs the job at once */
+#ifndef TASKPOOL_DEQUE_SIZE
+  #define TASKPOOL_DEQUE_SIZE           64ul
+#endif
+
+#ifndef TASKPOOL_WORKER_STACK_SIZE
+  #define TASKPOOL_WORKER_STACK_SIZE    2048ul
+#endif
+
+/* most chunks of one TaskPool_ParallelFor (their descriptors live on the caller stack) */
+#ifndef TASKPOOL_FOR_MAX_CHUNKS
+  #define TASKPOOL_FOR_MAX_CHUNKS       16ul
+#endif
+
+#define TASKPOOL_ALIGN                  XCHAL_DCACHE_LINESIZE
+
+//=============================================================================
+// Types
+//=============================================================================
+typedef void (*TaskPool_FuncType)(void* Arg);
+typedef void (*TaskPool_RangeFuncType)(uint32 Begin, uint32 End, void* Arg);
+
+/* jobs spawned together and joined together */
+typedef struct
+{
+  volatile uint32       Pending;    /* jobs not done, TASKPOOL_JOIN_WAITING once the joiner blocks */
+  Os_TaskType* volatile pJoiner;
+}TaskPool_GroupType;
+
+/* job owned by the caller (must stay valid until its group is joined) */
+typedef struct
+{
+  TaskPool_FuncType   Func;
+  void*               Arg;
+  TaskPool_GroupType* pGroup;
+}TaskPool_JobType;
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+boolean TaskPool_Init(uint32 Priority);
+void TaskPool_GroupInit(TaskPool_GroupType* pGroup);
+void TaskPool_Spawn(TaskPool_GroupType* pGroup, TaskPool_JobType* pJob, TaskPool_FuncType Func, void* Arg);
+void TaskPool_Join(TaskPool_GroupType* pGroup);
+void TaskPool_ParallelFor(uint32 Begin, uint32 End, uint32 Grain, TaskPool_RangeFuncType Func, void* Arg);
+uint32 TaskPool_GetSteals(uint32 Core);
+
+#endif
@@ -0,0 +1,173 @@
+/******************************************************************************************
+  Filename    : TaskPoolBench.c
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Speedup benchmark of the task pool on a FIR filter (make TASKPOOL_BENCH=1)
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "TaskPoolBench.h"
+#include "TaskPool.h"
+#include "Os.h"
+#include "printf.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define TASKPOOL_BENCH_STACK_SIZE     2048ul
+#define TASKPOOL_BENCH_NUM_GRAINS     4ul
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define TASKPOOL_BENCH_READ_CCOUNT(x) __asm__ volatile ("rsr.ccount %0" : "=r"(x))
+
+//=============================================================================
+// Globals
+//=============================================================================
+static Os_TaskType TaskPoolBench_Task;
+static uint32 TaskPoolBench_Stack[TASKPOOL_BENCH_STACK_SIZE / sizeof(uint32)];
+
+static const uint32 TaskPoolBench_Grain[TASKPOOL_BENCH_NUM_GRAINS] = { 64ul, 128ul, 512ul, TASKPOOL_BENCH_SAMPLES };
+
+static float TaskPoolBench_Input[TASKPOOL_BENCH_SAMPLES + TASKPOOL_BENCH_TAPS - 1ul];
+static float TaskPoolBench_Coef[TASKPOOL_BENCH_TAPS];
+static float TaskPoolBench_Serial[TASKPOOL_BENCH_SAMPLES];
+static float TaskPoolBench_Parallel[TASKPOOL_BENCH_SAMPLES];
+
+//=============================================================================
+// Static functions
+//=============================================================================
+static void TaskPoolBench_Run(void* Arg);
+static void TaskPoolBench_Fir(uint32 Begin, uint32 End, void* Arg);
+
+//-----------------------------------------------------------------------------------------
+/// \brief  TaskPoolBench_Start function
+///
+/// \descr  Creates the benchmark task on core 0 (it runs once after Os_Start, then exits).
+///
+/// \param  Priority : priority of the task (not below the pool workers)
+///
+/// \return TRUE if the task is created
+//-----------------------------------------------------------------------------------------
+COLD_ATTR boolean TaskPoolBench_Start(uint32 Priority)
+{
+  return(Os_CreateTask(&TaskPoolBench_Task, TaskPoolBench_Run, NULL, Priority, 0ul,
+                       TaskPoolBench_Stack, TASKPOOL_BENCH_STACK_SIZE));
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  TaskPoolBench_Run function
+///
+/// \descr  Filters the same input on core 0 alone, then with TaskPool_ParallelFor for a few
+///         grains. Prints one line per grain:
+///         TASKPOOL FIR <grain> <cycles alone> <cycles pool> <speedup> <steals> <OK|FAIL>
+///         FAIL means that an output sample differs from the single core result.
+///
+/// \param  Arg : unused
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void TaskPoolBench_Run(void* Arg)
+{
+  uint32 Seed = 1ul;
+  uint32 Start;
+  uint32 Alone;
+  uint32 Pool;
+  uint32 Steals;
+  uint32 Speedup;
+  boolean Ok;
+  uint32 g;
+  uint32 i;
+
+  (void)Arg;
+
+  /* low-pass triangle window and a pseudo-random input */
+  for(i = 0ul; i < TASKPOOL_BENCH_TAPS; i++)
+  {
+    TaskPoolBench_Coef[i] = (float)((i < (TASKPOOL_BENCH_TAPS / 2ul)) ? (i + 1ul) : (TASKPOOL_BENCH_TAPS - i)) / (float)(TASKPOOL_BENCH_TAPS * TASKPOOL_BENCH_TAPS / 4ul);
+  }
+
+  for(i = 0ul; i < (TASKPOOL_BENCH_SAMPLES + TASKPOOL_BENCH_TAPS - 1ul); i++)
+  {
+    Seed = (Seed * 1103515245ul) + 12345ul;
+    TaskPoolBench_Input[i] = ((float)(Seed >> 16) - 32768.0f) / 32768.0f;
+  }
+
+  TASKPOOL_BENCH_READ_CCOUNT(Start);
+  TaskPoolBench_Fir(0ul, TASKPOOL_BENCH_SAMPLES, TaskPoolBench_Serial);
+  TASKPOOL_BENCH_READ_CCOUNT(Alone);
+  Alone -= Start;
+
+  for(g = 0ul; g < TASKPOOL_BENCH_NUM_GRAINS; g++)
+  {
+    Steals = TaskPool_GetSteals(1ul);
+
+    TASKPOOL_BENCH_READ_CCOUNT(Start);
+    TaskPool_ParallelFor(0ul, TASKPOOL_BENCH_SAMPLES, TaskPoolBench_Grain[g], TaskPoolBench_Fir, TaskPoolBench_Parallel);
+    TASKPOOL_BENCH_READ_CCOUNT(Pool);
+    Pool -= Start;
+
+    Steals = TaskPool_GetSteals(1ul) - Steals;
+
+    /* each sample is computed in the same order on both paths */
+    Ok = TRUE;
+
+    for(i = 0ul; i < TASKPOOL_BENCH_SAMPLES; i++)
+    {
+      if(TaskPoolBench_Parallel[i] != TaskPoolBench_Serial[i])
+      {
+        Ok = FALSE;
+      }
+
+      TaskPoolBench_Parallel[i] = 0.0f;
+    }
+
+    Speedup = (Alone * 100ul) / Pool;
+
+    printf("TASKPOOL FIR %lu %lu %lu %lu.%02lu %lu %s\r\n", TaskPoolBench_Grain[g], Alone, Pool,
+                                                            Speedup / 100ul, Speedup % 100ul, Steals,
+                                                            (Ok == TRUE) ? "OK" : "FAIL");
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  TaskPoolBench_Fir function
+///
+/// \param  Begin : first output sample
+///         End   : sample after the last one
+///         Arg   : output array
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void TaskPoolBench_Fir(uint32 Begin, uint32 End, void* Arg)
+{
+  float* pOut = (float*)Arg;
+  float Acc;
+  uint32 n;
+  uint32 k;
+
+  for(n = Begin; n < End; n++)
+  {
+    Acc = 0.0f;
+
+    for(k = 0ul; k < TASKPOOL_BENCH_TAPS; k++)
+    {
+      Acc += TaskPoolBench_Coef[k] * TaskPoolBench_Input[n + k];
+    }
+
+    pOut[n] = Acc;
+  }
+}
@@ -0,0 +1,45 @@
+/******************************************************************************************
+  Filename    : TaskPoolBench.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Speedup benchmark of the task pool on a FIR filter header file
+                (make TASKPOOL_BENCH=1)
+
+******************************************************************************************/
+
+#ifndef __TASK_POOL_BENCH_H__
+#define __TASK_POOL_BENCH_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* output samples and taps of the filter */
+#ifndef TASKPOOL_BENCH_SAMPLES
+  #define TASKPOOL_BENCH_SAMPLES    2048ul
+#endif
+
+#ifndef TASKPOOL_BENCH_TAPS
+  #define TASKPOOL_BENCH_TAPS       32ul
+#endif
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+boolean TaskPoolBench_Start(uint32 Priority);
+
+#endif
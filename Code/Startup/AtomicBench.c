@@ -0,0 +1,192 @@
+/******************************************************************************************
+  Filename    : AtomicBench.c
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Contention benchmark of the atomics and spinlocks across both cores
+                (make ATOMIC_BENCH=1)
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "AtomicBench.h"
+#include "Atomic.h"
+#include "Spinlock.h"
+#include "Ipc.h"
+#include "printf.h"
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define ATOMIC_BENCH_READ_CCOUNT(x)   __asm__ volatile ("rsr.ccount %0" : "=r"(x))
+
+//=============================================================================
+// Types
+//=============================================================================
+typedef enum
+{
+  ATOMIC_BENCH_FETCH_ADD = 0,
+  ATOMIC_BENCH_EXCHANGE,
+  ATOMIC_BENCH_SPINLOCK,
+  ATOMIC_BENCH_SPINLOCK_IRQ,
+  ATOMIC_BENCH_NUM_TESTS
+}AtomicBench_TestType;
+
+//=============================================================================
+// Globals
+//=============================================================================
+static const char* const AtomicBench_Name[ATOMIC_BENCH_NUM_TESTS] = { "FETCH_ADD", "EXCHANGE", "SPINLOCK", "SPINLOCK_IRQ" };
+
+static Spinlock_Type AtomicBench_Lock = SPINLOCK_INIT;
+
+static volatile uint32 AtomicBench_Counter;
+static volatile uint32 AtomicBench_Ready;
+static volatile uint32 AtomicBench_Go;
+static volatile uint32 AtomicBench_Done;
+static volatile uint32 AtomicBench_Core1Cycles;
+
+//=============================================================================
+// Static functions
+//=============================================================================
+static uint32 AtomicBench_Loop(AtomicBench_TestType Test);
+static void AtomicBench_Core1(void* Arg);
+
+//-----------------------------------------------------------------------------------------
+/// \brief  AtomicBench_Run function
+///
+/// \descr  Runs each test alone on core 0, then on both cores at once (core 1 runs its
+///         part from its IPC interrupt). Prints one line per test:
+///         ATOMIC <test> <cycles/op alone> <cycles/op core 0> <cycles/op core 1> <OK|FAIL>
+///         FAIL means that the shared counter lost an update.
+///
+/// \param  void
+///
+/// \return TRUE if no update is lost
+//-----------------------------------------------------------------------------------------
+COLD_ATTR boolean AtomicBench_Run(void)
+{
+  boolean Result = TRUE;
+  uint32 Test;
+  uint32 Alone;
+  uint32 Core0;
+  boolean Ok;
+
+  for(Test = 0ul; Test < (uint32)ATOMIC_BENCH_NUM_TESTS; Test++)
+  {
+    /* uncontended */
+    AtomicBench_Counter = 0ul;
+    Alone = AtomicBench_Loop((AtomicBench_TestType)Test);
+
+    /* contended: both cores leave the start barrier together */
+    AtomicBench_Counter = 0ul;
+    AtomicBench_Ready   = 0ul;
+    AtomicBench_Go      = 0ul;
+    AtomicBench_Done    = 0ul;
+    ATOMIC_BARRIER();
+
+    if(Ipc_Post(1ul, AtomicBench_Core1, (void*)Test) == FALSE)
+    {
+      return(FALSE);
+    }
+
+    while(Atomic_LoadAcquire(&AtomicBench_Ready) == 0ul);
+
+    Atomic_StoreRelease(&AtomicBench_Go, 1ul);
+
+    Core0 = AtomicBench_Loop((AtomicBench_TestType)Test);
+
+    while(Atomic_LoadAcquire(&AtomicBench_Done) == 0ul);
+
+    /* the exchange test only checks that both cores ran, the others count every operation */
+    Ok = (Test == (uint32)ATOMIC_BENCH_EXCHANGE) ? TRUE : ((AtomicBench_Counter == (2ul * ATOMIC_BENCH_ITERATIONS)) ? TRUE : FALSE);
+
+    if(Ok == FALSE)
+    {
+      Result = FALSE;
+    }
+
+    printf("ATOMIC %s %lu %lu %lu %s\r\n", AtomicBench_Name[Test],
+                                           Alone / ATOMIC_BENCH_ITERATIONS,
+                                           Core0 / ATOMIC_BENCH_ITERATIONS,
+                                           AtomicBench_Core1Cycles / ATOMIC_BENCH_ITERATIONS,
+                                           (Ok == TRUE) ? "OK" : "FAIL");
+  }
+
+  return(Result);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  AtomicBench_Loop function
+///
+/// \param  Test : operation to repeat
+///
+/// \return CPU cycles of ATOMIC_BENCH_ITERATIONS operations
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR uint32 AtomicBench_Loop(AtomicBench_TestType Test)
+{
+  uint32 Start;
+  uint32 End;
+  uint32 Ps;
+  uint32 i;
+
+  ATOMIC_BENCH_READ_CCOUNT(Start);
+
+  for(i = 0ul; i < ATOMIC_BENCH_ITERATIONS; i++)
+  {
+    switch(Test)
+    {
+      case ATOMIC_BENCH_FETCH_ADD:
+        (void)Atomic_FetchAdd(&AtomicBench_Counter, 1ul);
+        break;
+
+      case ATOMIC_BENCH_EXCHANGE:
+        (void)Atomic_Exchange(&AtomicBench_Counter, i);
+        break;
+
+      case ATOMIC_BENCH_SPINLOCK:
+        Spinlock_Lock(&AtomicBench_Lock);
+        AtomicBench_Counter++;
+        Spinlock_Unlock(&AtomicBench_Lock);
+        break;
+
+      case ATOMIC_BENCH_SPINLOCK_IRQ:
+      default:
+        Ps = Spinlock_LockIrqSave(&AtomicBench_Lock);
+        AtomicBench_Counter++;
+        Spinlock_UnlockIrqRestore(&AtomicBench_Lock, Ps);
+        break;
+    }
+  }
+
+  ATOMIC_BENCH_READ_CCOUNT(End);
+
+  return(End - Start);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  AtomicBench_Core1 function
+///
+/// \param  Arg : test (AtomicBench_TestType)
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void AtomicBench_Core1(void* Arg)
+{
+  Atomic_StoreRelease(&AtomicBench_Ready, 1ul);
+
+  while(Atomic_LoadAcquire(&AtomicBench_Go) == 0ul);
+
+  AtomicBench_Core1Cycles = AtomicBench_Loop((AtomicBench_TestType)(uint32)Arg);
+
+  Atomic_StoreRelease(&AtomicBench_Done, 1ul);
+}
@@ -0,0 +1,40 @@
+/******************************************************************************************
+  Filename    : AtomicBench.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Contention benchmark of the atomics and spinlocks across both cores header file
+
+******************************************************************************************/
+
+#ifndef __ATOMIC_BENCH_H__
+#define __ATOMIC_BENCH_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* operations run by each core in each test */
+#ifndef ATOMIC_BENCH_ITERATIONS
+  #define ATOMIC_BENCH_ITERATIONS   10000ul
+#endif
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+boolean AtomicBench_Run(void);
+
+#endif
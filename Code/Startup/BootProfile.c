@@ -0,0 +1,178 @@
+/******************************************************************************************
+  Filename    : BootProfile.c
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Boot time profiler (phase timestamps of Startup_Init)
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "BootProfile.h"
+#include "esp32s3.h"
+#include "printf.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define BOOT_PROFILE_MAGIC    0xB0075EEDul
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define BOOT_PROFILE_READ_CCOUNT(x)  __asm__ volatile ("rsr.ccount %0" : "=r"(x))
+
+//=============================================================================
+// Globals
+//=============================================================================
+
+/* note: the record is written before the RAM initialization, it must not be part of .bss nor .data */
+static volatile BootProfile_RecordType BootProfile_Record NOINIT_ATTR;
+
+static const char* const BootProfile_PhaseName[BOOT_PROFILE_PHASE_NUM] =
+{
+  "Reset",
+  "InitCore",
+  "InitSystemClock",
+  "InitFlashCache",
+  "StartCore1",
+  "InitRam",
+  "InitCtors",
+  "Main",
+  "Core1Release"
+};
+
+//-----------------------------------------------------------------------------------------
+/// \brief  BootProfile_Start function
+///
+/// \descr  Opens a new record and marks the reset phase, called first in Startup_Init.
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR void BootProfile_Start(void)
+{
+  BootProfile_Record.Magic        = BOOT_PROFILE_MAGIC;
+  BootProfile_Record.MarkedPhases = 0ul;
+
+  BootProfile_Mark(BOOT_PROFILE_RESET);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  BootProfile_Mark function
+///
+/// \param  Phase : phase that just ended
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR void BootProfile_Mark(BootProfile_PhaseType Phase)
+{
+  uint32 Ccount;
+
+  if((BootProfile_Record.Magic != BOOT_PROFILE_MAGIC) || (Phase >= BOOT_PROFILE_PHASE_NUM))
+  {
+    return;
+  }
+
+  BOOT_PROFILE_READ_CCOUNT(Ccount);
+
+  SYSTIMER->UNIT0_OP.bit.TIMER_UNIT0_UPDATE = 1;
+  while(SYSTIMER->UNIT0_OP.bit.TIMER_UNIT0_VALUE_VALID == 0);
+
+  BootProfile_Record.Stamp[Phase].Ccount   = Ccount;
+  BootProfile_Record.Stamp[Phase].SysTimer = SYSTIMER->UNIT0_VALUE_LO.reg;
+  BootProfile_Record.MarkedPhases         |= (1ul << Phase);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  BootProfile_GetElapsedUs function
+///
+/// \param  Phase : marked phase
+///
+/// \return time elapsed from the chip reset to the end of the phase (0 if not marked)
+//-----------------------------------------------------------------------------------------
+uint32 BootProfile_GetElapsedUs(BootProfile_PhaseType Phase)
+{
+  if((Phase >= BOOT_PROFILE_PHASE_NUM) || ((BootProfile_Record.MarkedPhases & (1ul << Phase)) == 0ul))
+  {
+    return(0ul);
+  }
+
+  return(BootProfile_Record.Stamp[Phase].SysTimer / BOOT_PROFILE_SYSTIMER_MHZ);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  BootProfile_CheckBudget function
+///
+/// \param  void
+///
+/// \return TRUE if the core 1 release happened within BOOT_PROFILE_BUDGET_US (or no budget is set)
+//-----------------------------------------------------------------------------------------
+boolean BootProfile_CheckBudget(void)
+{
+  const uint32 ElapsedUs = BootProfile_GetElapsedUs(BOOT_PROFILE_CORE1_RELEASE);
+
+  if(BOOT_PROFILE_BUDGET_US == 0ul)
+  {
+    return(TRUE);
+  }
+
+  return(((ElapsedUs != 0ul) && (ElapsedUs <= BOOT_PROFILE_BUDGET_US)) ? TRUE : FALSE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  BootProfile_Print function
+///
+/// \descr  Prints the record as a table, the "BOOTPROF" lines are parsed by
+///         Tools/scripts/BootProfileParser.py.
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+COLD_ATTR void BootProfile_Print(void)
+{
+  uint32 PrevSysTimer = 0ul;
+
+  if(BootProfile_Record.Magic != BOOT_PROFILE_MAGIC)
+  {
+    printf("BOOTPROF INVALID\r\n");
+    return;
+  }
+
+  printf("BOOTPROF BEGIN %lu\r\n", BOOT_PROFILE_SYSTIMER_MHZ);
+
+  for(uint32 phase = 0; phase < (uint32)BOOT_PROFILE_PHASE_NUM; phase++)
+  {
+    if((BootProfile_Record.MarkedPhases & (1ul << phase)) == 0ul)
+    {
+      continue;
+    }
+
+    /* columns: phase, name, systimer ticks since reset, ccount, phase duration in us */
+    printf("BOOTPROF %2lu %-16s %10lu %10lu %8lu\r\n",
+           phase,
+           BootProfile_PhaseName[phase],
+           BootProfile_Record.Stamp[phase].SysTimer,
+           BootProfile_Record.Stamp[phase].Ccount,
+           (BootProfile_Record.Stamp[phase].SysTimer - PrevSysTimer) / BOOT_PROFILE_SYSTIMER_MHZ);
+
+    PrevSysTimer = BootProfile_Record.Stamp[phase].SysTimer;
+  }
+
+  printf("BOOTPROF END %lu %lu %s\r\n",
+         BootProfile_GetElapsedUs(BOOT_PROFILE_CORE1_RELEASE),
+         BOOT_PROFILE_BUDGET_US,
+         (BootProfile_CheckBudget() == TRUE) ? "OK" : "OVER");
+}
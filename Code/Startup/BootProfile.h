@@ -0,0 +1,79 @@
+/******************************************************************************************
+  Filename    : BootProfile.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Boot time profiler header file
+
+******************************************************************************************/
+
+#ifndef __BOOT_PROFILE_H__
+#define __BOOT_PROFILE_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* boot time budget in microseconds measured from the chip reset to the core 1 release (0: no budget) */
+#ifndef BOOT_PROFILE_BUDGET_US
+  #define BOOT_PROFILE_BUDGET_US    0ul
+#endif
+
+/* SYSTIMER counter frequency (fixed, independent of the CPU clock) */
+#define BOOT_PROFILE_SYSTIMER_MHZ   16ul
+
+//=============================================================================
+// Types
+//=============================================================================
+
+/* end of each phase of Startup_Init (the order is the execution order) */
+typedef enum
+{
+  BOOT_PROFILE_RESET = 0,
+  BOOT_PROFILE_INIT_CORE,
+  BOOT_PROFILE_INIT_CLOCK,
+  BOOT_PROFILE_INIT_FLASH_CACHE,
+  BOOT_PROFILE_START_CORE1,
+  BOOT_PROFILE_INIT_RAM,
+  BOOT_PROFILE_INIT_CTORS,
+  BOOT_PROFILE_MAIN,
+  BOOT_PROFILE_CORE1_RELEASE,
+  BOOT_PROFILE_PHASE_NUM
+}BootProfile_PhaseType;
+
+typedef struct
+{
+  uint32 Ccount;    /* CPU cycle counter (its rate changes with the clock configuration) */
+  uint32 SysTimer;  /* SYSTIMER unit 0 low word (16 MHz since the chip reset) */
+}BootProfile_StampType;
+
+typedef struct
+{
+  uint32 Magic;
+  uint32 MarkedPhases;
+  BootProfile_StampType Stamp[BOOT_PROFILE_PHASE_NUM];
+}BootProfile_RecordType;
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+void BootProfile_Start(void);
+void BootProfile_Mark(BootProfile_PhaseType Phase);
+uint32 BootProfile_GetElapsedUs(BootProfile_PhaseType Phase);
+boolean BootProfile_CheckBudget(void);
+void BootProfile_Print(void);
+
+#endif
@@ -0,0 +1,191 @@
+/******************************************************************************************
+  Filename    : CpuTimer.c
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Periodic CPU timers (CCOMPARE0..2) with absolute deadlines
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "CpuTimer.h"
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define CPU_TIMER_READ_CCOUNT(x)      __asm__ volatile ("rsr.ccount %0" : "=r"(x))
+#define CPU_TIMER_WRITE_SR(sr, x)     __asm__ volatile ("wsr." #sr " %0\n\tesync" : : "r"(x) : "memory")
+
+//=============================================================================
+// Types
+//=============================================================================
+typedef struct
+{
+  uint32 Deadline;    /* CCOUNT of the current period on the grid */
+  uint32 Period;      /* 0: not started */
+  uint32 Missed;
+  CpuTimer_CatchUpType CatchUp;
+}CpuTimer_StateType;
+
+//=============================================================================
+// Externs
+//=============================================================================
+extern uint32 get_core_id(void);
+
+//=============================================================================
+// Globals
+//=============================================================================
+static CpuTimer_StateType CpuTimer_State[CPU_TIMER_NUM_CORES][CPU_TIMER_NUM];
+
+//=============================================================================
+// Static functions
+//=============================================================================
+static void CpuTimer_WriteCompare(uint32 TimerId, uint32 Compare);
+
+//-----------------------------------------------------------------------------------------
+/// \brief  CpuTimer_StartPeriodic function
+///
+/// \descr  Starts a periodic CPU timer of the calling core, the first deadline is one
+///         period from now. The handler of its CPU interrupt (6, 15 or 16) must call
+///         CpuTimer_Rearm, which also clears the interrupt.
+///
+/// \param  TimerId : 0, 1 or 2 (CCOMPARE0..2)
+///         Period  : period in CPU cycles (CPU_TIMER_MIN_LEAD < Period < 2^31)
+///         CatchUp : behavior on a missed deadline
+///
+/// \return TRUE if the timer is started
+//-----------------------------------------------------------------------------------------
+boolean CpuTimer_StartPeriodic(uint32 TimerId, uint32 Period, CpuTimer_CatchUpType CatchUp)
+{
+  CpuTimer_StateType* pState;
+  uint32 Now;
+
+  if((TimerId >= CPU_TIMER_NUM) || (Period <= CPU_TIMER_MIN_LEAD) || (Period >= 0x80000000ul))
+  {
+    return(FALSE);
+  }
+
+  pState = &CpuTimer_State[get_core_id()][TimerId];
+
+  CPU_TIMER_READ_CCOUNT(Now);
+
+  pState->Deadline = Now + Period;
+  pState->Period   = Period;
+  pState->Missed   = 0ul;
+  pState->CatchUp  = CatchUp;
+
+  CpuTimer_WriteCompare(TimerId, pState->Deadline);
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  CpuTimer_Rearm function
+///
+/// \descr  Called by the timer handler. The next deadline is the previous one plus the
+///         period (CCOMPAREn += period), so the interrupt latency does not accumulate.
+///         If that deadline is already too close or gone, the catch-up policy applies.
+///
+/// \param  TimerId : 0, 1 or 2
+///
+/// \return number of periods behind the grid (0 when on time)
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR uint32 CpuTimer_Rearm(uint32 TimerId)
+{
+  CpuTimer_StateType* pState;
+  uint32 Now;
+  uint32 Late;
+  uint32 Missed;
+
+  if(TimerId >= CPU_TIMER_NUM)
+  {
+    return(0ul);
+  }
+
+  pState = &CpuTimer_State[get_core_id()][TimerId];
+
+  if(pState->Period == 0ul)
+  {
+    return(0ul);
+  }
+
+  pState->Deadline += pState->Period;
+
+  CPU_TIMER_READ_CCOUNT(Now);
+
+  /* wrap-safe: the deadline is on time while it is at least CPU_TIMER_MIN_LEAD ahead of CCOUNT */
+  if((sint32)(pState->Deadline - Now) >= (sint32)CPU_TIMER_MIN_LEAD)
+  {
+    CpuTimer_WriteCompare(TimerId, pState->Deadline);
+    return(0ul);
+  }
+
+  Late   = (Now + CPU_TIMER_MIN_LEAD) - pState->Deadline;
+  Missed = (Late / pState->Period) + 1ul;
+
+  switch(pState->CatchUp)
+  {
+    case CPU_TIMER_CATCHUP_BURST:
+      /* fire again right away, the grid deadline advances by one period per interrupt
+         (each late period is counted once, when its own rearm finds it late) */
+      pState->Missed++;
+      CpuTimer_WriteCompare(TimerId, Now + CPU_TIMER_MIN_LEAD);
+      break;
+
+    case CPU_TIMER_CATCHUP_REPORT:
+      pState->Missed  += Missed;
+      pState->Deadline = Now + pState->Period;
+      CpuTimer_WriteCompare(TimerId, pState->Deadline);
+      break;
+
+    case CPU_TIMER_CATCHUP_SKIP:
+    default:
+      pState->Missed   += Missed;
+      pState->Deadline += Missed * pState->Period;
+      CpuTimer_WriteCompare(TimerId, pState->Deadline);
+      break;
+  }
+
+  return(Missed);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  CpuTimer_GetMissed function
+///
+/// \param  TimerId : 0, 1 or 2
+///
+/// \return deadlines missed on the calling core since CpuTimer_StartPeriodic
+//-----------------------------------------------------------------------------------------
+uint32 CpuTimer_GetMissed(uint32 TimerId)
+{
+  return((TimerId < CPU_TIMER_NUM) ? CpuTimer_State[get_core_id()][TimerId].Missed : 0ul);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  CpuTimer_WriteCompare function
+///
+/// \param  TimerId : 0, 1 or 2
+///         Compare : CCOUNT value of the next interrupt (the write clears the pending one)
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void CpuTimer_WriteCompare(uint32 TimerId, uint32 Compare)
+{
+  switch(TimerId)
+  {
+    case 0ul: CPU_TIMER_WRITE_SR(ccompare0, Compare); break;
+    case 1ul: CPU_TIMER_WRITE_SR(ccompare1, Compare); break;
+    case 2ul: CPU_TIMER_WRITE_SR(ccompare2, Compare); break;
+    default: break;
+  }
+}
@@ -0,0 +1,54 @@
+/******************************************************************************************
+  Filename    : CpuTimer.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Periodic CPU timers (CCOMPARE0..2) with absolute deadlines header file
+
+******************************************************************************************/
+
+#ifndef __CPU_TIMER_H__
+#define __CPU_TIMER_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define CPU_TIMER_NUM_CORES       2ul
+#define CPU_TIMER_NUM             3ul
+
+/* a compare value is never programmed closer than this to CCOUNT (a missed match waits for a full wrap) */
+#define CPU_TIMER_MIN_LEAD        64ul
+
+//=============================================================================
+// Types
+//=============================================================================
+
+/* behavior when the handler rearms after its next deadline has already passed */
+typedef enum
+{
+  CPU_TIMER_CATCHUP_SKIP = 0,   /* drop the missed periods, stay on the original grid */
+  CPU_TIMER_CATCHUP_BURST,      /* run the missed periods back to back until the grid is reached again */
+  CPU_TIMER_CATCHUP_REPORT      /* no catch-up, the grid restarts one period from now */
+}CpuTimer_CatchUpType;
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+boolean CpuTimer_StartPeriodic(uint32 TimerId, uint32 Period, CpuTimer_CatchUpType CatchUp);
+uint32 CpuTimer_Rearm(uint32 TimerId);
+uint32 CpuTimer_GetMissed(uint32 TimerId);
+
+#endif
@@ -0,0 +1,189 @@
+/******************************************************************************************
+  Filename    : Crash.c
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Crash record in the RTC memory (fatal exceptions and panics)
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Crash.h"
+#include "esp32s3.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* frame sent on the UART: sync word, record length (16-bit little endian), record */
+#define CRASH_FRAME_SYNC              "CRSH"
+#define CRASH_FRAME_SYNC_SIZE         4ul
+
+#define CRASH_CRC32_POLY              0xEDB88320ul
+
+/* keep one byte free in the 128-byte UART TX FIFO */
+#define CRASH_UART_FIFO_LIMIT         127ul
+
+//=============================================================================
+// Globals
+//=============================================================================
+
+/* one record per core, filled by CrashCapture (IntVectTable.s) and kept across the system reset */
+Crash_RecordType Crash_Record[CRASH_NUM_CORES] RTC_NOINIT_ATTR;
+
+typedef char Crash_RecordSizeCheck[(sizeof(Crash_RecordType) == CRASH_RECORD_SIZE) ? 1 : -1];
+
+//=============================================================================
+// Static functions
+//=============================================================================
+static uint32 Crash_ComputeCrc(const Crash_RecordType* pRecord);
+static boolean Crash_IsValid(const Crash_RecordType* pRecord);
+static void Crash_Seal(Crash_RecordType* pRecord);
+static void Crash_PutByte(uint8 Byte);
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Crash_Finalize function
+///
+/// \descr  Called by CrashCapture on the initial stack of the core once the registers
+///         and the stack snapshot are in the record. Seals the record and resets the
+///         chip, the RTC fast memory keeps the record for the next boot.
+///
+/// \param  pRecord : record of the faulting core
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR void Crash_Finalize(Crash_RecordType* pRecord)
+{
+  Crash_Seal(pRecord);
+
+  RTC_CNTL->OPTIONS0.bit.SW_SYS_RST = 1;
+
+  for(;;);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Crash_ReportPrevious function
+///
+/// \descr  Sends the records left by a crash before the last reset on UART0 in binary
+///         form (decoded on the host by Tools/scripts/CrashDecoder.py) and clears them.
+///
+/// \param  void
+///
+/// \return TRUE if at least one record was sent
+//-----------------------------------------------------------------------------------------
+COLD_ATTR boolean Crash_ReportPrevious(void)
+{
+  boolean Reported = FALSE;
+
+  for(uint32 core = 0; core < CRASH_NUM_CORES; core++)
+  {
+    const uint8* pByte = (const uint8*)&Crash_Record[core];
+
+    if(Crash_IsValid(&Crash_Record[core]) == FALSE)
+    {
+      continue;
+    }
+
+    for(uint32 i = 0; i < CRASH_FRAME_SYNC_SIZE; i++)
+    {
+      Crash_PutByte((uint8)CRASH_FRAME_SYNC[i]);
+    }
+
+    Crash_PutByte((uint8)(CRASH_RECORD_SIZE & 0xFFul));
+    Crash_PutByte((uint8)(CRASH_RECORD_SIZE >> 8));
+
+    for(uint32 i = 0; i < CRASH_RECORD_SIZE; i++)
+    {
+      Crash_PutByte(pByte[i]);
+    }
+
+    Crash_Record[core].Magic = 0ul;
+
+    Reported = TRUE;
+  }
+
+  return(Reported);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Crash_ComputeCrc function
+///
+/// \param  pRecord : crash record
+///
+/// \return CRC-32 (IEEE 802.3, as zlib.crc32) of the record bytes before the Crc field
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR uint32 Crash_ComputeCrc(const Crash_RecordType* pRecord)
+{
+  const uint8* pByte = (const uint8*)pRecord;
+  uint32 Crc = 0xFFFFFFFFul;
+
+  for(uint32 i = 0; i < (CRASH_RECORD_SIZE - 4ul); i++)
+  {
+    Crc ^= pByte[i];
+
+    for(uint32 bit = 0; bit < 8ul; bit++)
+    {
+      Crc = ((Crc & 1ul) != 0ul) ? ((Crc >> 1) ^ CRASH_CRC32_POLY) : (Crc >> 1);
+    }
+  }
+
+  return(~Crc);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Crash_Seal function
+///
+/// \descr  The magic is inside the CRC range (as checked by Crash_IsValid and by the
+///         decoder), so it is stored first and the CRC last.
+///
+/// \param  pRecord : crash record
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void Crash_Seal(Crash_RecordType* pRecord)
+{
+  pRecord->Magic = CRASH_MAGIC;
+  pRecord->Crc   = Crash_ComputeCrc(pRecord);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Crash_IsValid function
+///
+/// \param  pRecord : crash record
+///
+/// \return TRUE if the record was sealed by Crash_Finalize (the RTC memory content is
+///         random after a power-on)
+//-----------------------------------------------------------------------------------------
+static COLD_ATTR boolean Crash_IsValid(const Crash_RecordType* pRecord)
+{
+  if((pRecord->Magic != CRASH_MAGIC) || (pRecord->StackWords > CRASH_STACK_WORDS))
+  {
+    return(FALSE);
+  }
+
+  return((pRecord->Crc == Crash_ComputeCrc(pRecord)) ? TRUE : FALSE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Crash_PutByte function
+///
+/// \param  Byte : byte written to the UART0 TX FIFO once there is room
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static COLD_ATTR void Crash_PutByte(uint8 Byte)
+{
+  while(UART0->STATUS.bit.TXFIFO_CNT >= CRASH_UART_FIFO_LIMIT);
+
+  UART0->FIFO.reg = Byte;
+}
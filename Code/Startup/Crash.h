@@ -0,0 +1,82 @@
+/******************************************************************************************
+  Filename    : Crash.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Crash record in the RTC memory (fatal exceptions and panics) header file
+
+******************************************************************************************/
+
+#ifndef __CRASH_H__
+#define __CRASH_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define CRASH_NUM_CORES               2ul
+
+/* record valid marker (inside the CRC range, the CRC is written last) */
+#define CRASH_MAGIC                   0xC4A5D0E7ul
+
+/* words of the stack copied from the SP of the faulting code */
+#define CRASH_STACK_WORDS             64ul
+
+/* record size in bytes (the layout is shared with CrashCapture in IntVectTable.s) */
+#define CRASH_RECORD_SIZE             ((41ul * 4ul) + (CRASH_STACK_WORDS * 4ul) + 4ul)
+
+/* reasons */
+#define CRASH_REASON_KERNEL_EXCEPTION 1ul
+#define CRASH_REASON_USER_EXCEPTION   2ul
+#define CRASH_REASON_DOUBLE_EXCEPTION 3ul
+#define CRASH_REASON_INVALID_VECTOR   4ul
+#define CRASH_REASON_PANIC            5ul
+
+/* panic codes (A2 of the record, the panic argument is in A3) */
+#define CRASH_PANIC_STACK_OVERFLOW    1ul
+#define CRASH_PANIC_UNHANDLED_IRQ     2ul
+
+//=============================================================================
+// Types
+//=============================================================================
+typedef struct
+{
+  uint32 Magic;
+  uint32 Core;
+  uint32 Reason;
+  uint32 ExcCause;
+  uint32 ExcVAddr;
+  uint32 Ps;
+  uint32 Sar;
+  uint32 Lbeg;
+  uint32 Lend;
+  uint32 Lcount;
+  uint32 Depc;
+  uint32 Epc[7];
+  uint32 Eps[6];
+  uint32 A[16];
+  uint32 StackWords;
+  uint32 Stack[CRASH_STACK_WORDS];
+  uint32 Crc;
+}Crash_RecordType;
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+void Crash_Panic(uint32 Code, uint32 Arg) __attribute__((noreturn));
+void Crash_Finalize(Crash_RecordType* pRecord) __attribute__((noreturn));
+boolean Crash_ReportPrevious(void);
+
+#endif
@@ -0,0 +1,145 @@
+/******************************************************************************************
+  Filename    : DeepSleep.c
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Deep sleep and early wake hook (run by Startup_Init after the bootROM
+                has loaded the image, before the clock, RAM and C runtime initialization)
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "DeepSleep.h"
+#include "esp32s3.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* PRO CPU reset cause: wakeup from deep sleep */
+#define DEEP_SLEEP_RESET_CAUSE_WAKEUP   0x05ul
+
+#define DEEP_SLEEP_RTC_TIMER_HI_MASK        0xFFFFul
+#define DEEP_SLEEP_RTC_ALARM_EN             (1ul << 16)
+#define DEEP_SLEEP_WAKEUP_ENA_MASK          0x1FFFFul
+
+//=============================================================================
+// Globals
+//=============================================================================
+
+/* note: the RTC fast memory is retained in deep sleep and is not re-copied on a deep-sleep wakeup */
+static volatile DeepSleep_WakeHookType DeepSleep_WakeHook RTC_FAST_ATTR = NULL;
+static volatile uint32 DeepSleep_SleepMs                  RTC_FAST_ATTR = 0ul;
+static volatile uint32 DeepSleep_WakeupSources            RTC_FAST_ATTR = 0ul;
+static volatile uint32 DeepSleep_WakeCount                RTC_FAST_ATTR = 0ul;
+
+//-----------------------------------------------------------------------------------------
+/// \brief  DeepSleep_SetWakeHook function
+///
+/// \param  Hook          : early wake hook (NULL: every wakeup boots the application)
+///         SleepMs       : sleep duration used by the timer wakeup source
+///         WakeupSources : DEEP_SLEEP_SOURCE_xxx bitmap
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void DeepSleep_SetWakeHook(DeepSleep_WakeHookType Hook, uint32 SleepMs, uint32 WakeupSources)
+{
+  DeepSleep_WakeHook      = Hook;
+  DeepSleep_SleepMs       = SleepMs;
+  DeepSleep_WakeupSources = WakeupSources;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  DeepSleep_Enter function
+///
+/// \descr  Arms the wakeup sources, keeps the RTC memories powered and powers down the
+///         digital core. The function does not return, the wakeup is a reset.
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+RTC_IRAM_ATTR void DeepSleep_Enter(void)
+{
+  const uint32 Ticks = DeepSleep_SleepMs * DEEP_SLEEP_RTC_SLOW_TICKS_PER_MS;
+  uint32 TimeLo;
+  uint32 TimeHi;
+
+  /* wakeup time (48-bit RTC timer) */
+  RTC_CNTL->TIME_UPDATE.bit.TIME_UPDATE = 1;
+  TimeLo = RTC_CNTL->TIME_LOW0.reg;
+  TimeHi = RTC_CNTL->TIME_HIGH0.reg & DEEP_SLEEP_RTC_TIMER_HI_MASK;
+
+  TimeHi += ((TimeLo + Ticks) < TimeLo) ? 1ul : 0ul;
+  TimeLo += Ticks;
+
+  RTC_CNTL->SLP_TIMER0.reg = TimeLo;
+  RTC_CNTL->SLP_TIMER1.reg = (TimeHi & DEEP_SLEEP_RTC_TIMER_HI_MASK) | DEEP_SLEEP_RTC_ALARM_EN;
+
+  /* wakeup sources */
+  RTC_CNTL->WAKEUP_STATE.bit.WAKEUP_ENA = DeepSleep_WakeupSources & DEEP_SLEEP_WAKEUP_ENA_MASK;
+
+  /* keep the RTC fast and slow memories powered, power down the digital core */
+  RTC_CNTL->PWC.bit.FASTMEM_FORCE_LPU = 1;
+  RTC_CNTL->PWC.bit.SLOWMEM_FORCE_LPU = 1;
+  RTC_CNTL->DIG_PWC.bit.DG_WRAP_PD_EN = 1;
+
+  /* clear the pending wakeup/reject states and enter the sleep */
+  RTC_CNTL->INT_CLR_RTC.reg = 0xFFFFFFFFul;
+  RTC_CNTL->STATE0.bit.SLEEP_EN = 1;
+
+  for(;;);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  DeepSleep_RunWakeHook function
+///
+/// \descr  Called first in Startup_Init (before the clock, the RAM and the C runtime
+///         initialization). On a deep-sleep wakeup, the hook decides whether the
+///         device goes back to sleep (the function does not return) or boots.
+///         note: the ROM wake entry (RTC STORE6/STORE7) is not used, so the bootROM has
+///         already loaded the image from flash. Only the rest of the startup is skipped.
+///         Kept in IRAM, the RTC fast memory is only valid after a deep sleep.
+///
+/// \param  void
+///
+/// \return TRUE on a deep-sleep wakeup (the RTC memories must be kept as is)
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR boolean DeepSleep_RunWakeHook(void)
+{
+  if(RTC_CNTL->RESET_STATE.bit.RESET_CAUSE_PROCPU != DEEP_SLEEP_RESET_CAUSE_WAKEUP)
+  {
+    return(FALSE);
+  }
+
+  DeepSleep_WakeCount++;
+
+  if((DeepSleep_WakeHook != NULL) && (DeepSleep_WakeHook() == FALSE))
+  {
+    DeepSleep_Enter();
+  }
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  DeepSleep_GetWakeCount function
+///
+/// \param  void
+///
+/// \return number of deep-sleep wakeups since the last cold boot
+//-----------------------------------------------------------------------------------------
+uint32 DeepSleep_GetWakeCount(void)
+{
+  return(DeepSleep_WakeCount);
+}
@@ -0,0 +1,55 @@
+/******************************************************************************************
+  Filename    : DeepSleep.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Deep sleep and early wake hook header file
+
+******************************************************************************************/
+
+#ifndef __DEEP_SLEEP_H__
+#define __DEEP_SLEEP_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* wakeup sources (RTC_CNTL WAKEUP_ENA bitmap) */
+#define DEEP_SLEEP_SOURCE_TIMER          (1ul << 3)
+#define DEEP_SLEEP_SOURCE_ULP_RISCV      (1ul << 11)
+
+/* RTC slow clock ticks per millisecond (internal RC oscillator, not calibrated) */
+#ifndef DEEP_SLEEP_RTC_SLOW_TICKS_PER_MS
+  #define DEEP_SLEEP_RTC_SLOW_TICKS_PER_MS   136ul
+#endif
+
+//=============================================================================
+// Types
+//=============================================================================
+
+/* early wake hook (IRAM or RTC_IRAM_ATTR code, may only use the RTC memories and the peripherals:
+   the clock and .bss are not initialized yet), returns TRUE to boot the application or FALSE to go back to sleep */
+typedef boolean (*DeepSleep_WakeHookType)(void);
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+void DeepSleep_SetWakeHook(DeepSleep_WakeHookType Hook, uint32 SleepMs, uint32 WakeupSources);
+void DeepSleep_Enter(void);
+boolean DeepSleep_RunWakeHook(void);
+uint32 DeepSleep_GetWakeCount(void);
+
+#endif
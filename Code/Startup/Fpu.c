@@ -0,0 +1,172 @@
+/******************************************************************************************
+  Filename    : Fpu.c
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Lazy FPU context switch (CPENABLE and the coprocessor 0 disabled exception)
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Fpu.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* MISC2 holds the innermost interrupt frame ORed with its level (the frames are 16-byte aligned) */
+#define FPU_ISR_LEVEL_MASK        0x0Ful
+
+/* word offset of the FP save area pointer in the call_isr frame (FRAME_FPU_AREA in IntVectTable.s) */
+#define FPU_FRAME_AREA_IDX        31ul
+
+#define FPU_CPENABLE_CP0          1ul
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define FPU_READ_CPENABLE(x)      __asm__ volatile ("rsr.cpenable %0" : "=r"(x))
+#define FPU_WRITE_CPENABLE(x)     __asm__ volatile ("wsr.cpenable %0\n\trsync" : : "r"(x) : "memory")
+
+//=============================================================================
+// Externs
+//=============================================================================
+extern uint32 get_core_id(void);
+
+//=============================================================================
+// Globals
+//=============================================================================
+
+/* FP state of the code preempted by each interrupt level that used the FPU */
+static Fpu_ContextType Fpu_IsrArea[FPU_NUM_CORES][FPU_NUM_ISR_LEVELS];
+
+/* thread level: context of the running thread and context whose state is in the FPU */
+static Fpu_ContextType* volatile Fpu_Current[FPU_NUM_CORES];
+static Fpu_ContextType* volatile Fpu_Owner[FPU_NUM_CORES];
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Fpu_SwitchContext function
+///
+/// \descr  Called by a scheduler when it switches to another thread.
+///         The FPU is disabled, the registers are exchanged on the next FP instruction
+///         only if the new thread uses the FPU.
+///
+/// \param  pNext : FP save area of the next thread (NULL: the thread does not own one)
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR void Fpu_SwitchContext(Fpu_ContextType* pNext)
+{
+  Fpu_Current[get_core_id()] = pNext;
+
+  FPU_WRITE_CPENABLE(0ul);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Fpu_FlushContext function
+///
+/// \descr  Called by a scheduler before a thread may resume on the other core. If the FP
+///         state of the thread is still in the FPU of the calling core, it is saved in
+///         its area and the FPU has no owner anymore, so the other core restores it.
+///
+/// \param  pContext : FP save area of the switched out thread
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR void Fpu_FlushContext(Fpu_ContextType* pContext)
+{
+  const uint32 Core = get_core_id();
+  uint32 CpEnable;
+
+  if(Fpu_Owner[Core] == pContext)
+  {
+    FPU_READ_CPENABLE(CpEnable);
+    FPU_WRITE_CPENABLE(CpEnable | FPU_CPENABLE_CP0);
+
+    Fpu_SaveRegs(pContext);
+    Fpu_Owner[Core] = NULL;
+
+    FPU_WRITE_CPENABLE(CpEnable);
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Fpu_DropContext function
+///
+/// \descr  Called by a scheduler when a thread terminates. Its FP state is not saved, and
+///         the area may be reused as soon as the FPU of the calling core no longer owns it.
+///
+/// \param  pContext : FP save area of the terminated thread
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR void Fpu_DropContext(Fpu_ContextType* pContext)
+{
+  const uint32 Core = get_core_id();
+
+  if(Fpu_Owner[Core] == pContext)
+  {
+    Fpu_Owner[Core] = NULL;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Fpu_CoprocessorException function
+///
+/// \descr  Coprocessor 0 disabled exception (EXCCAUSE 32), called from the level 1
+///         vectors. Inside an interrupt handler, the FP state of the preempted code is
+///         saved in the area of the interrupt level and given back by call_isr at the
+///         end of the handler. At thread level, the FP registers move from their owner
+///         to the running thread.
+///
+/// \param  IsrFrame : MISC2 (innermost call_isr frame | level, 0 at thread level)
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR void Fpu_CoprocessorException(uint32 IsrFrame)
+{
+  const uint32 Core = get_core_id();
+  uint32 CpEnable;
+
+  FPU_READ_CPENABLE(CpEnable);
+  FPU_WRITE_CPENABLE(CpEnable | FPU_CPENABLE_CP0);
+
+  if(IsrFrame != 0ul)
+  {
+    const uint32 Level     = IsrFrame & FPU_ISR_LEVEL_MASK;
+    uint32* const pFrame   = (uint32*)(IsrFrame & ~FPU_ISR_LEVEL_MASK);
+    Fpu_ContextType* pArea = &Fpu_IsrArea[Core][Level & (FPU_NUM_ISR_LEVELS - 1ul)];
+
+    Fpu_SaveRegs(pArea);
+
+    pFrame[FPU_FRAME_AREA_IDX] = (uint32)pArea;
+  }
+  else if(Fpu_Owner[Core] != Fpu_Current[Core])
+  {
+    if(Fpu_Owner[Core] != NULL)
+    {
+      Fpu_SaveRegs(Fpu_Owner[Core]);
+    }
+
+    if(Fpu_Current[Core] != NULL)
+    {
+      Fpu_RestoreRegs(Fpu_Current[Core]);
+    }
+
+    Fpu_Owner[Core] = Fpu_Current[Core];
+  }
+  else
+  {
+    /* the FP state of the running thread is already in the FPU */
+  }
+}
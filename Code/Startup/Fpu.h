@@ -0,0 +1,56 @@
+/******************************************************************************************
+  Filename    : Fpu.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Lazy FPU context switch header file
+
+******************************************************************************************/
+
+#ifndef __FPU_H__
+#define __FPU_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define FPU_NUM_CORES             2ul
+
+/* one save area per interrupt level (1..7), a level is active at most once per core */
+#define FPU_NUM_ISR_LEVELS        8ul
+
+//=============================================================================
+// Types
+//=============================================================================
+
+/* FP register file (layout used by Fpu_SaveRegs/Fpu_RestoreRegs in IntVectTable.s) */
+typedef struct
+{
+  uint32 F[16];
+  uint32 Fcr;
+  uint32 Fsr;
+}Fpu_ContextType;
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+void Fpu_SwitchContext(Fpu_ContextType* pNext);
+void Fpu_FlushContext(Fpu_ContextType* pContext);
+void Fpu_DropContext(Fpu_ContextType* pContext);
+void Fpu_CoprocessorException(uint32 IsrFrame);
+void Fpu_SaveRegs(Fpu_ContextType* pContext);
+void Fpu_RestoreRegs(const Fpu_ContextType* pContext);
+
+#endif
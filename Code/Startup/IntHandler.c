@@ -19,6 +19,9 @@
 // Includes
 //=============================================================================
 #include <stdint.h>
+#include "Platform_Types.h"
+#include "Stack.h"
+#include "Irq.h"
 
 //=============================================================================
 // Functions prototype
@@ -29,13 +32,7 @@ void Isr_Level2Interrupt(uint32_t irq);
 void Isr_Level3Interrupt(uint32_t irq);
 void Isr_Level4Interrupt(uint32_t irq);
 void Isr_Level5Interrupt(uint32_t irq);
-
-//=============================================================================
-// Externs
-//=============================================================================
-extern void blink_led(void);
-extern void systicktimer_1us_base(void);
-extern void systicktimer_1ms_base(void);
+void Isr_NmiInterrupt(uint32_t irq);
 
 /*******************************************************************************************
   \brief  
@@ -44,10 +41,9 @@ extern void systicktimer_1ms_base(void);
   
   \return 
 ********************************************************************************************/
-void Isr_Level1KernelInterrupt(uint32_t irq)
+IRAM_ATTR void Isr_Level1KernelInterrupt(uint32_t irq)
 {
-  (void)irq;
-  for(;;);
+  Irq_Dispatch(1, irq);
 }
 
 /*******************************************************************************************
@@ -57,10 +53,9 @@ void Isr_Level1KernelInterrupt(uint32_t irq)
   
   \return 
 ********************************************************************************************/
-void Isr_Level1UserInterrupt(uint32_t irq)
+IRAM_ATTR void Isr_Level1UserInterrupt(uint32_t irq)
 {
-  if(irq & (1ul << 6))
-    systicktimer_1us_base();
+  Irq_Dispatch(1, irq);
 }
 
 /*******************************************************************************************
@@ -70,10 +65,9 @@ void Isr_Level1UserInterrupt(uint32_t irq)
   
   \return 
 ********************************************************************************************/
-void Isr_Level2Interrupt(uint32_t irq)
+IRAM_ATTR void Isr_Level2Interrupt(uint32_t irq)
 {
-  (void)irq;
-  for(;;);
+  Irq_Dispatch(2, irq);
 }
 
 /*******************************************************************************************
@@ -83,10 +77,9 @@ void Isr_Level2Interrupt(uint32_t irq)
   
   \return 
 ********************************************************************************************/
-void Isr_Level3Interrupt(uint32_t irq)
+IRAM_ATTR void Isr_Level3Interrupt(uint32_t irq)
 {
-  if(irq & (1ul << 15))
-    blink_led();
+  Irq_Dispatch(3, irq);
 }
 
 /*******************************************************************************************
@@ -96,10 +89,9 @@ void Isr_Level3Interrupt(uint32_t irq)
   
   \return 
 ********************************************************************************************/
-void Isr_Level4Interrupt(uint32_t irq)
+IRAM_ATTR void Isr_Level4Interrupt(uint32_t irq)
 {
-  (void)irq;
-  for(;;);
+  Irq_Dispatch(4, irq);
 }
 
 /*******************************************************************************************
@@ -109,8 +101,22 @@ void Isr_Level4Interrupt(uint32_t irq)
   
   \return 
 ********************************************************************************************/
-void Isr_Level5Interrupt(uint32_t irq)
+IRAM_ATTR void Isr_Level5Interrupt(uint32_t irq)
 {
-  if(irq & (1ul << 16))
-    systicktimer_1ms_base();
+  Irq_Dispatch(5, irq);
+}
+
+/*******************************************************************************************
+  \brief  NMI handler (CPU interrupt 14, the stack overflow guard is routed to it)
+  
+  \param  irq : pending interrupts
+  
+  \return void
+********************************************************************************************/
+IRAM_ATTR void Isr_NmiInterrupt(uint32_t irq)
+{
+  (void)irq;
+
+  if(Stack_IsOverflowPending() == TRUE)
+    Stack_OverflowHandler();
 }
\ No newline at end of file
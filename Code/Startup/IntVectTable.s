@@ -15,6 +15,64 @@
   
 ******************************************************************************************/
 
+/* interrupt stack frame built by call_isr (144 bytes, keeps SP 16-byte aligned) */
+.equ FRAME_SAR,        15*4
+.equ FRAME_LBEG,       16*4
+.equ FRAME_LEND,       17*4
+.equ FRAME_LCOUNT,     18*4
+.equ FRAME_ACCLO,      19*4
+.equ FRAME_ACCHI,      20*4
+.equ FRAME_M0,         21*4
+.equ FRAME_M1,         22*4
+.equ FRAME_M2,         23*4
+.equ FRAME_M3,         24*4
+.equ FRAME_BR,         25*4
+.equ FRAME_SCOMPARE1,  26*4
+.equ FRAME_EPC,        27*4
+.equ FRAME_EPS,        28*4
+.equ FRAME_PS,         29*4
+.equ FRAME_CPENABLE,   30*4
+.equ FRAME_FPU_AREA,   31*4
+.equ FRAME_PREV_ISR,   32*4
+.equ FRAME_SIZE,       36*4
+
+/* PS.EXCM and PS.INTLEVEL */
+.equ PS_EXCM_INTLEVEL_MASK, 0x1F
+
+/* crash record filled by CrashCapture (Crash_RecordType in Crash.h) */
+.equ CRASH_CORE,         1*4
+.equ CRASH_REASON,       2*4
+.equ CRASH_EXCCAUSE,     3*4
+.equ CRASH_EXCVADDR,     4*4
+.equ CRASH_PS,           5*4
+.equ CRASH_SAR,          6*4
+.equ CRASH_LBEG,         7*4
+.equ CRASH_LEND,         8*4
+.equ CRASH_LCOUNT,       9*4
+.equ CRASH_DEPC,        10*4
+.equ CRASH_EPC,         11*4
+.equ CRASH_EPS,         18*4
+.equ CRASH_A0,          24*4
+.equ CRASH_STACK_COUNT, 40*4
+.equ CRASH_STACK,       41*4
+.equ CRASH_RECORD_SIZE, 106*4
+.equ CRASH_STACK_WORDS, 64
+
+/* reasons (CRASH_REASON_xxx in Crash.h) */
+.equ CRASH_REASON_KERNEL_EXCEPTION, 1
+.equ CRASH_REASON_USER_EXCEPTION,   2
+.equ CRASH_REASON_DOUBLE_EXCEPTION, 3
+.equ CRASH_REASON_INVALID_VECTOR,   4
+.equ CRASH_REASON_PANIC,            5
+
+/* stack snapshot only from the internal data RAM (D_SRAM in Memory_Map.ld) */
+.equ CRASH_DRAM_START,  0x3FC88000
+.equ CRASH_DRAM_END,    0x3FD00000
+
+/* EXCCAUSE values handled by the level 1 vectors */
+.equ EXCCAUSE_LEVEL1_INTERRUPT, 4
+.equ EXCCAUSE_CP0_DISABLED,     32
+
 /*******************************************************************************************
   \brief  
   
@@ -22,8 +80,9 @@
   
   \return 
 ********************************************************************************************/
-.macro SaveCpuContext
-    addi sp, sp, -4*15
+.macro SaveCpuContext level
+    addi sp, sp, -(FRAME_SIZE - 16)
+    addi sp, sp, -16
     s32i.n a0,  sp, 0*4
     s32i.n a2,  sp, 1*4
     s32i.n a3,  sp, 2*4
@@ -39,6 +98,41 @@
     s32i.n a13,  sp, 12*4
     s32i.n a14,  sp, 13*4
     s32i.n a15,  sp, 14*4
+    rsr a2, sar
+    s32i a2, sp, FRAME_SAR
+    rsr a2, lbeg
+    s32i a2, sp, FRAME_LBEG
+    rsr a2, lend
+    s32i a2, sp, FRAME_LEND
+    rsr a2, lcount
+    s32i a2, sp, FRAME_LCOUNT
+    rsr a2, acclo
+    s32i a2, sp, FRAME_ACCLO
+    rsr a2, acchi
+    s32i a2, sp, FRAME_ACCHI
+    rsr a2, m0
+    s32i a2, sp, FRAME_M0
+    rsr a2, m1
+    s32i a2, sp, FRAME_M1
+    rsr a2, m2
+    s32i a2, sp, FRAME_M2
+    rsr a2, m3
+    s32i a2, sp, FRAME_M3
+    rsr a2, br
+    s32i a2, sp, FRAME_BR
+    rsr a2, scompare1
+    s32i a2, sp, FRAME_SCOMPARE1
+  .if \level == 1
+    rsr a2, epc1
+    s32i a2, sp, FRAME_EPC
+  .else
+    rsr a2, epc\level
+    s32i a2, sp, FRAME_EPC
+    rsr a2, eps\level
+    s32i a2, sp, FRAME_EPS
+  .endif
+    rsr a2, ps
+    s32i a2, sp, FRAME_PS
 .endm
 
 /*******************************************************************************************
@@ -48,7 +142,41 @@
   
   \return 
 ********************************************************************************************/
-.macro RestoreCpuContext
+.macro RestoreCpuContext level
+  .if \level == 1
+    l32i a2, sp, FRAME_EPC
+    wsr a2, epc1
+  .else
+    l32i a2, sp, FRAME_EPC
+    wsr a2, epc\level
+    l32i a2, sp, FRAME_EPS
+    wsr a2, eps\level
+  .endif
+    l32i a2, sp, FRAME_SCOMPARE1
+    wsr a2, scompare1
+    l32i a2, sp, FRAME_BR
+    wsr a2, br
+    l32i a2, sp, FRAME_M3
+    wsr a2, m3
+    l32i a2, sp, FRAME_M2
+    wsr a2, m2
+    l32i a2, sp, FRAME_M1
+    wsr a2, m1
+    l32i a2, sp, FRAME_M0
+    wsr a2, m0
+    l32i a2, sp, FRAME_ACCHI
+    wsr a2, acchi
+    l32i a2, sp, FRAME_ACCLO
+    wsr a2, acclo
+    l32i a2, sp, FRAME_LEND
+    wsr a2, lend
+    l32i a2, sp, FRAME_LBEG
+    wsr a2, lbeg
+    l32i a2, sp, FRAME_LCOUNT
+    wsr a2, lcount
+    isync
+    l32i a2, sp, FRAME_SAR
+    wsr a2, sar
     l32i.n a0,  sp, 0*4
     l32i.n a2,  sp, 1*4
     l32i.n a3,  sp, 2*4
@@ -64,7 +192,121 @@
     l32i.n a13,  sp, 12*4
     l32i.n a14,  sp, 13*4
     l32i.n a15,  sp, 14*4
-    addi sp, sp, 4*15
+    addi sp, sp, FRAME_SIZE - 16
+    addi sp, sp, 16
+.endm
+
+/*******************************************************************************************
+  \brief  
+  
+  \param  
+  
+  \return 
+********************************************************************************************/
+.macro RestoreVectorPs
+    /* back to the PS of the vector (EXCM set) before restoring the return state */
+    l32i a2, sp, FRAME_PS
+    wsr a2, ps
+    rsync
+.endm
+
+/*******************************************************************************************
+  \brief  
+  
+  \param  
+  
+  \return 
+********************************************************************************************/
+.macro FpuEnterIsr level
+    /* the FPU is disabled in the handler, its first FP instruction raises the
+       coprocessor 0 disabled exception which saves the preempted FP state (see Fpu.c) */
+    rsr a2, cpenable
+    s32i a2, sp, FRAME_CPENABLE
+    movi a2, 0
+    s32i a2, sp, FRAME_FPU_AREA
+    wsr a2, cpenable
+    /* MISC2 = innermost interrupt frame | level */
+    rsr a2, misc2
+    s32i a2, sp, FRAME_PREV_ISR
+    addi a2, sp, \level
+    wsr a2, misc2
+    rsync
+.endm
+
+/*******************************************************************************************
+  \brief  
+  
+  \param  
+  
+  \return 
+********************************************************************************************/
+.macro FpuLeaveIsr
+    l32i a2, sp, FRAME_FPU_AREA
+    beqz a2, .L_fpu_untouched\@
+    /* the handler used the FPU: give the preempted FP state back */
+    movi a3, 1
+    wsr a3, cpenable
+    rsync
+    call0 Fpu_RestoreRegs
+.L_fpu_untouched\@:
+    l32i a2, sp, FRAME_CPENABLE
+    wsr a2, cpenable
+    l32i a2, sp, FRAME_PREV_ISR
+    wsr a2, misc2
+    rsync
+.endm
+
+/*******************************************************************************************
+  \brief  
+  
+  \param  
+  
+  \return 
+********************************************************************************************/
+.macro EnableNesting level
+    /* no zero-overhead loop of the interrupted code may fire in the handler */
+    movi a2, 0
+    wsr a2, lcount
+    /* clear PS.EXCM and mask only the levels up to the current one */
+    rsr a2, ps
+    movi a3, ~PS_EXCM_INTLEVEL_MASK
+    and a2, a2, a3
+    movi a3, \level
+    or a2, a2, a3
+    wsr a2, ps
+    rsync
+.endm
+
+/*******************************************************************************************
+  \brief  IrqLatencyStamp: CCOUNT at the vector entry, parked in EXCSAVE of the level
+          without using a register (read back by Irq_Dispatch, see IrqLatency.c)
+  
+  \param  level : interrupt level
+  
+  \return 
+********************************************************************************************/
+.macro IrqLatencyStamp level
+    wsr a2, excsave\level
+    rsr a2, ccount
+    xsr a2, excsave\level
+.endm
+
+/*******************************************************************************************
+  \brief  OsSwitchTask: lets the scheduler exchange the frame of the interrupted task for
+          the frame of the next task (see Os_SwitchFrame in Os.c), then moves the stack
+          guard once SP is on the new stack
+  
+  \param  
+  
+  \return 
+********************************************************************************************/
+.macro OsSwitchTask
+    mov a2, sp
+    call0 Os_SwitchFrame
+    beq a2, sp, .L_os_same_task\@
+    mov sp, a2
+    call0 Os_SwitchDone
+.L_os_same_task\@:
 .endm
 
 /*******************************************************************************************
@@ -74,11 +316,61 @@
   
   \return 
 ********************************************************************************************/
-.macro call_isr isr_name
-    SaveCpuContext
+.macro call_isr isr_name, level
+  .ifdef IRQ_LATENCY_ENABLED
+    IrqLatencyStamp \level
+  .endif
+    SaveCpuContext \level
+    FpuEnterIsr \level
+  .if \level < 7
+    EnableNesting \level
+  .endif
     rsr a2, interrupt
     call0 \isr_name
-    RestoreCpuContext
+    RestoreVectorPs
+    FpuLeaveIsr
+  .if \level == 1
+    /* the tasks are only switched here (a level 1 interrupt always preempts the thread level) */
+    OsSwitchTask
+  .endif
+    RestoreCpuContext \level
+.endm
+
+/*******************************************************************************************
+  \brief  CrashCapture: stores a1-a15 in the crash record of the core and continues in
+          Crash_Capture (only a0 is used before, it is parked in MISC3)
+  
+  \param  reason : CRASH_REASON_xxx
+  
+  \return never returns
+********************************************************************************************/
+.macro CrashCapture reason
+    wsr a0, misc3
+    rsr a0, prid
+    extui a0, a0, 13, 1
+    beqz a0, .L_crash_core0\@
+    movi a0, Crash_Record + CRASH_RECORD_SIZE
+    j .L_crash_save\@
+.L_crash_core0\@:
+    movi a0, Crash_Record
+.L_crash_save\@:
+    s32i a1,  a0, CRASH_A0 + 1*4
+    s32i a2,  a0, CRASH_A0 + 2*4
+    s32i a3,  a0, CRASH_A0 + 3*4
+    s32i a4,  a0, CRASH_A0 + 4*4
+    s32i a5,  a0, CRASH_A0 + 5*4
+    s32i a6,  a0, CRASH_A0 + 6*4
+    s32i a7,  a0, CRASH_A0 + 7*4
+    s32i a8,  a0, CRASH_A0 + 8*4
+    s32i a9,  a0, CRASH_A0 + 9*4
+    s32i a10, a0, CRASH_A0 + 10*4
+    s32i a11, a0, CRASH_A0 + 11*4
+    s32i a12, a0, CRASH_A0 + 12*4
+    s32i a13, a0, CRASH_A0 + 13*4
+    s32i a14, a0, CRASH_A0 + 14*4
+    s32i a15, a0, CRASH_A0 + 15*4
+    movi a2, \reason
+    j Crash_Capture
 .endm
 
 /*******************************************************************************************
@@ -98,6 +390,9 @@
 .extern Level3InterruptVectorHandler
 .extern Level4InterruptVectorHandler
 .extern Level5InterruptVectorHandler
+.extern NMIExceptionVectorHandler
+.extern Crash_DoubleException
+.extern Crash_InvalidVector
 
 _vector_table:
 
@@ -127,7 +422,7 @@ _vector_table:
 
         .org _vector_table + 0x2c0
         NMIExceptionVector:
-                        j .
+                        j NMIExceptionVectorHandler
 
         .org _vector_table + 0x300
         Level1KernalInterruptVector:
@@ -139,11 +434,11 @@ _vector_table:
 
         .org _vector_table + 0x3C0
         DoubleExceptionVector:
-                        j .
+                        j Crash_DoubleException
 
         .org _vector_table + 0x400
         InvalidExceptionVector:
-                        j .
+                        j Crash_InvalidVector
 
 
 .size _vector_table, .-_vector_table
@@ -155,7 +450,7 @@ _vector_table:
   
   \return 
 ********************************************************************************************/
-.section  .text,"ax"
+.section  .iram.hot,"ax"
 .global _vector_handlers
 .type _vector_handlers, @function
 .align 4
@@ -165,35 +460,231 @@ _vector_table:
 .extern Isr_Level3Interrupt
 .extern Isr_Level4Interrupt
 .extern Isr_Level5Interrupt
+.extern Isr_NmiInterrupt
+.extern Fpu_CoprocessorException
+.extern Os_SwitchFrame
+.extern Os_SwitchDone
 
 _vector_handlers:
 
         Level2InterruptVectorHandler:
-                        call_isr Isr_Level2Interrupt
+                        call_isr Isr_Level2Interrupt, 2
                         rfi 2
 
         Level3InterruptVectorHandler:
-                        call_isr Isr_Level3Interrupt
+                        call_isr Isr_Level3Interrupt, 3
                         rfi 3
 
+        /* level 4 and level 5: a fast handler installed in MISC0/MISC1 (see Irq_RegisterFast)
+           is called directly with only a0 spilled to EXCSAVE, otherwise call_isr is used */
         Level4InterruptVectorHandler:
-                        call_isr Isr_Level4Interrupt
+                        wsr a0, excsave4
+                        rsr a0, misc0
+                        beqz a0, .L_level4_call_isr
+                        callx0 a0
+                        rsr a0, excsave4
+                        rfi 4
+        .L_level4_call_isr:
+                        rsr a0, excsave4
+                        call_isr Isr_Level4Interrupt, 4
                         rfi 4
 
         Level5InterruptVectorHandler:
-                        call_isr Isr_Level5Interrupt
+                        wsr a0, excsave5
+                        rsr a0, misc1
+                        beqz a0, .L_level5_call_isr
+                        callx0 a0
+                        rsr a0, excsave5
+                        rfi 5
+        .L_level5_call_isr:
+                        rsr a0, excsave5
+                        call_isr Isr_Level5Interrupt, 5
                         rfi 5
 
+        NMIExceptionVectorHandler:
+                        call_isr Isr_NmiInterrupt, 7
+                        rfi 7
+
+        /* level 1: the kernel and user vectors also receive the general exceptions,
+           every cause other than the interrupt and the lazy FPU switch is fatal */
         Level1KernalInterruptVectorHandler:
-                        call_isr Isr_Level1KernelInterrupt
+                        wsr a2, excsave1
+                        rsr a2, exccause
+                        beqi a2, EXCCAUSE_LEVEL1_INTERRUPT, .L_level1_kernal_interrupt
+                        beqi a2, EXCCAUSE_CP0_DISABLED, .L_level1_kernal_cp0
+                        rsr a2, excsave1
+                        j Crash_KernelException
+        .L_level1_kernal_cp0:
+                        j .L_coprocessor0_disabled
+        .L_level1_kernal_interrupt:
+                        rsr a2, excsave1
+                        call_isr Isr_Level1KernelInterrupt, 1
                         rfe
 
         Level1UserInterruptVectorHandler:
-                        call_isr Isr_Level1UserInterrupt
+                        wsr a2, excsave1
+                        rsr a2, exccause
+                        beqi a2, EXCCAUSE_LEVEL1_INTERRUPT, .L_level1_user_interrupt
+                        beqi a2, EXCCAUSE_CP0_DISABLED, .L_level1_user_cp0
+                        rsr a2, excsave1
+                        j Crash_UserException
+        .L_level1_user_cp0:
+                        j .L_coprocessor0_disabled
+        .L_level1_user_interrupt:
+                        rsr a2, excsave1
+                        call_isr Isr_Level1UserInterrupt, 1
+                        rfe
+
+        /* first FP instruction with CPENABLE.CP0 cleared (lazy FPU context switch) */
+        .L_coprocessor0_disabled:
+                        rsr a2, excsave1
+                        SaveCpuContext 1
+                        movi a2, 0
+                        wsr a2, lcount
+                        rsr a2, misc2
+                        call0 Fpu_CoprocessorException
+                        RestoreCpuContext 1
                         rfe
 
 .size _vector_handlers, .-_vector_handlers
 
+/*******************************************************************************************
+  \brief  Fatal exception entries and Crash_Panic (C: void Crash_Panic(uint32 Code, uint32 Arg)),
+          they capture the state of the core into its crash record and reset the chip
+  
+  \param  
+  
+  \return 
+********************************************************************************************/
+.section  .iram.hot,"ax"
+.type _crash_handlers, @function
+.align 4
+.global Crash_KernelException
+.global Crash_UserException
+.global Crash_DoubleException
+.global Crash_InvalidVector
+.global Crash_Panic
+.extern Crash_Record
+.extern Crash_Finalize
+.extern __CORE0_STACK_TOP
+.extern __CORE1_STACK_TOP
+
+_crash_handlers:
+
+        Crash_KernelException:
+                        CrashCapture CRASH_REASON_KERNEL_EXCEPTION
+
+        Crash_UserException:
+                        CrashCapture CRASH_REASON_USER_EXCEPTION
+
+        Crash_DoubleException:
+                        CrashCapture CRASH_REASON_DOUBLE_EXCEPTION
+
+        Crash_InvalidVector:
+                        CrashCapture CRASH_REASON_INVALID_VECTOR
+
+        /* a2 = panic code, a3 = panic argument (kept in A2/A3 of the record) */
+        .align 4
+        Crash_Panic:
+                        CrashCapture CRASH_REASON_PANIC
+
+        /* a0 = record, a2 = reason */
+        Crash_Capture:
+                        s32i a2, a0, CRASH_REASON
+                        mov a2, a0
+                        rsr a3, misc3
+                        s32i a3, a2, CRASH_A0
+                        rsr a3, prid
+                        extui a3, a3, 13, 1
+                        s32i a3, a2, CRASH_CORE
+                        rsr a3, exccause
+                        s32i a3, a2, CRASH_EXCCAUSE
+                        rsr a3, excvaddr
+                        s32i a3, a2, CRASH_EXCVADDR
+                        rsr a3, ps
+                        s32i a3, a2, CRASH_PS
+                        rsr a3, sar
+                        s32i a3, a2, CRASH_SAR
+                        rsr a3, lbeg
+                        s32i a3, a2, CRASH_LBEG
+                        rsr a3, lend
+                        s32i a3, a2, CRASH_LEND
+                        rsr a3, lcount
+                        s32i a3, a2, CRASH_LCOUNT
+                        rsr a3, depc
+                        s32i a3, a2, CRASH_DEPC
+                        rsr a3, epc1
+                        s32i a3, a2, CRASH_EPC + 0*4
+                        rsr a3, epc2
+                        s32i a3, a2, CRASH_EPC + 1*4
+                        rsr a3, epc3
+                        s32i a3, a2, CRASH_EPC + 2*4
+                        rsr a3, epc4
+                        s32i a3, a2, CRASH_EPC + 3*4
+                        rsr a3, epc5
+                        s32i a3, a2, CRASH_EPC + 4*4
+                        rsr a3, epc6
+                        s32i a3, a2, CRASH_EPC + 5*4
+                        rsr a3, epc7
+                        s32i a3, a2, CRASH_EPC + 6*4
+                        rsr a3, eps2
+                        s32i a3, a2, CRASH_EPS + 0*4
+                        rsr a3, eps3
+                        s32i a3, a2, CRASH_EPS + 1*4
+                        rsr a3, eps4
+                        s32i a3, a2, CRASH_EPS + 2*4
+                        rsr a3, eps5
+                        s32i a3, a2, CRASH_EPS + 3*4
+                        rsr a3, eps6
+                        s32i a3, a2, CRASH_EPS + 4*4
+                        rsr a3, eps7
+                        s32i a3, a2, CRASH_EPS + 5*4
+
+                        /* mask all the interrupts and stop any zero-overhead loop */
+                        movi a3, PS_EXCM_INTLEVEL_MASK
+                        wsr a3, ps
+                        movi a3, 0
+                        wsr a3, lcount
+                        rsync
+
+                        /* stack snapshot from the SP of the faulting code (aligned, inside the DRAM) */
+                        l32i a3, a2, CRASH_A0 + 1*4
+                        movi a5, 0
+                        extui a4, a3, 0, 2
+                        bnez a4, .L_crash_stack_done
+                        movi a4, CRASH_DRAM_START
+                        bltu a3, a4, .L_crash_stack_done
+                        movi a4, CRASH_DRAM_END
+                        bgeu a3, a4, .L_crash_stack_done
+                        sub a4, a4, a3
+                        srli a4, a4, 2
+                        movi a5, CRASH_STACK_WORDS
+                        minu a5, a5, a4
+                        movi a4, CRASH_STACK
+                        add a4, a4, a2
+                        mov a6, a5
+        .L_crash_stack_copy:
+                        l32i a7, a3, 0
+                        s32i a7, a4, 0
+                        addi a3, a3, 4
+                        addi a4, a4, 4
+                        addi a6, a6, -1
+                        bnez a6, .L_crash_stack_copy
+        .L_crash_stack_done:
+                        s32i a5, a2, CRASH_STACK_COUNT
+
+                        /* continue on the initial stack of the core, the faulting SP is not trusted */
+                        rsr a3, prid
+                        extui a3, a3, 13, 1
+                        movi a1, __CORE0_STACK_TOP
+                        beqz a3, .L_crash_finalize
+                        movi a1, __CORE1_STACK_TOP
+        .L_crash_finalize:
+                        call0 Crash_Finalize
+                        j .
+
+.size _crash_handlers, .-_crash_handlers
+
 /*******************************************************************************************
   \brief  
   
@@ -201,7 +692,7 @@ _vector_handlers:
   
   \return 
 ********************************************************************************************/
-.section  .text,"ax"
+.section  .iram.hot,"ax"
 .type enable_irq, @function
 .align 4
 .global enable_irq
@@ -219,7 +710,7 @@ enable_irq:
   
   \return 
 ********************************************************************************************/
-.section  .text,"ax"
+.section  .iram.hot,"ax"
 .type disable_irq, @function
 .align 4
 .global disable_irq
@@ -237,7 +728,7 @@ disable_irq:
   
   \return 
 ********************************************************************************************/
-.section  .text,"ax"
+.section  .iram.hot,"ax"
 .type set_cpu_private_timer, @function
 .align 4
 .global set_cpu_private_timer
@@ -271,6 +762,80 @@ set_cpu_private_timer:
 
 .size set_cpu_private_timer, .-set_cpu_private_timer
 
+/*******************************************************************************************
+  \brief  Fpu_SaveRegs: stores f0-f15, FCR and FSR at a2 (CPENABLE.CP0 must be set)
+  
+  \param  
+  
+  \return 
+********************************************************************************************/
+.section  .iram.hot,"ax"
+.type Fpu_SaveRegs, @function
+.align 4
+.global Fpu_SaveRegs
+
+Fpu_SaveRegs:
+              ssi f0,  a2, 0*4
+              ssi f1,  a2, 1*4
+              ssi f2,  a2, 2*4
+              ssi f3,  a2, 3*4
+              ssi f4,  a2, 4*4
+              ssi f5,  a2, 5*4
+              ssi f6,  a2, 6*4
+              ssi f7,  a2, 7*4
+              ssi f8,  a2, 8*4
+              ssi f9,  a2, 9*4
+              ssi f10, a2, 10*4
+              ssi f11, a2, 11*4
+              ssi f12, a2, 12*4
+              ssi f13, a2, 13*4
+              ssi f14, a2, 14*4
+              ssi f15, a2, 15*4
+              rur.fcr a3
+              s32i a3, a2, 16*4
+              rur.fsr a3
+              s32i a3, a2, 17*4
+              ret
+
+.size Fpu_SaveRegs, .-Fpu_SaveRegs
+
+/*******************************************************************************************
+  \brief  Fpu_RestoreRegs: loads f0-f15, FCR and FSR from a2 (CPENABLE.CP0 must be set)
+  
+  \param  
+  
+  \return 
+********************************************************************************************/
+.section  .iram.hot,"ax"
+.type Fpu_RestoreRegs, @function
+.align 4
+.global Fpu_RestoreRegs
+
+Fpu_RestoreRegs:
+              lsi f0,  a2, 0*4
+              lsi f1,  a2, 1*4
+              lsi f2,  a2, 2*4
+              lsi f3,  a2, 3*4
+              lsi f4,  a2, 4*4
+              lsi f5,  a2, 5*4
+              lsi f6,  a2, 6*4
+              lsi f7,  a2, 7*4
+              lsi f8,  a2, 8*4
+              lsi f9,  a2, 9*4
+              lsi f10, a2, 10*4
+              lsi f11, a2, 11*4
+              lsi f12, a2, 12*4
+              lsi f13, a2, 13*4
+              lsi f14, a2, 14*4
+              lsi f15, a2, 15*4
+              l32i a3, a2, 16*4
+              wur.fcr a3
+              l32i a3, a2, 17*4
+              wur.fsr a3
+              ret
+
+.size Fpu_RestoreRegs, .-Fpu_RestoreRegs
+
 /*******************************************************************************************
   \brief  
   
@@ -0,0 +1,259 @@
+/******************************************************************************************
+  Filename    : Ipc.c
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Cross-core function calls: one single-producer/single-consumer ring per
+                target core in the shared DRAM, signaled by the SYSTEM FROM_CPU interrupt
+                of the target core
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Ipc.h"
+#include "Irq.h"
+#include "IntMatrix.h"
+#include "esp32s3.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* interrupt matrix sources FROM_CPU_INTR0/1 (the IRQn_Type enum of esp32s3.h is disabled) */
+#define IPC_SOURCE_CORE0          79ul
+#define IPC_SOURCE_CORE1          80ul
+
+//=============================================================================
+// Macros
+//=============================================================================
+
+/* orders the accesses to the ring as seen by the other core (the internal DRAM is not cached) */
+#define IPC_BARRIER()             __asm__ volatile ("memw" : : : "memory")
+#define IPC_LOCK(ps)              __asm__ volatile ("rsil %0, 15" : "=r"(ps) : : "memory")
+#define IPC_UNLOCK(ps)            __asm__ volatile ("wsr.ps %0\n\trsync" : : "r"(ps) : "memory")
+
+//=============================================================================
+// Types
+//=============================================================================
+
+/* Head is written by the posting core only, Tail by the target core only.
+   Both run freely, the slot is the index modulo IPC_QUEUE_SIZE. */
+typedef struct
+{
+  volatile uint32 Head;
+  volatile uint32 Tail;
+  Ipc_MsgType     Slot[IPC_QUEUE_SIZE];
+}Ipc_RingType;
+
+//=============================================================================
+// Externs
+//=============================================================================
+extern uint32 get_core_id(void);
+
+//=============================================================================
+// Globals
+//=============================================================================
+
+/* ring of each target core (the other core is the only producer) */
+static Ipc_RingType Ipc_Ring[IPC_NUM_CORES];
+
+static IntMatrix_RouteType Ipc_Route[IPC_NUM_CORES];
+
+typedef char Ipc_QueueSizeCheck[((IPC_QUEUE_SIZE & (IPC_QUEUE_SIZE - 1ul)) == 0ul) ? 1 : -1];
+
+//=============================================================================
+// Static functions
+//=============================================================================
+static void Ipc_Isr(void* Arg);
+static void Ipc_Raise(uint32 TargetCore);
+static void Ipc_Clear(uint32 Core);
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Ipc_Init function
+///
+/// \descr  Routes FROM_CPU_INTR0 to core 0 and FROM_CPU_INTR1 to core 1. Called once on
+///         core 0 before core 1 is released, each core then calls Ipc_Enable.
+///
+/// \param  void
+///
+/// \return TRUE if both receive interrupts are allocated
+//-----------------------------------------------------------------------------------------
+COLD_ATTR boolean Ipc_Init(void)
+{
+  Ipc_Clear(0ul);
+  Ipc_Clear(1ul);
+
+  if(IntMatrix_Allocate(IPC_SOURCE_CORE0, 0ul, IPC_LEVEL, Ipc_Isr, (void*)0ul, &Ipc_Route[0]) == FALSE)
+  {
+    return(FALSE);
+  }
+
+  return(IntMatrix_Allocate(IPC_SOURCE_CORE1, 1ul, IPC_LEVEL, Ipc_Isr, (void*)1ul, &Ipc_Route[1]));
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Ipc_Enable function
+///
+/// \descr  Enables the receive interrupt of the calling core. Calls posted before are
+///         executed right away.
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+COLD_ATTR void Ipc_Enable(void)
+{
+  Irq_Enable(Ipc_Route[get_core_id()].CpuInt);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Ipc_Post function
+///
+/// \descr  Queues a call of Func(Arg) on the other core and raises its IPC interrupt.
+///         It does not wait for the call. Callable from any context of the posting core,
+///         the local producers are serialized by masking the interrupts of that core.
+///
+/// \param  TargetCore : the other core (0 or 1)
+///         Func       : function to call on the target core
+///         Arg        : its argument (a pointer or a 32-bit message)
+///
+/// \return TRUE if queued, FALSE if the ring is full or the target is the calling core
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR boolean Ipc_Post(uint32 TargetCore, Ipc_FuncType Func, void* Arg)
+{
+  Ipc_RingType* pRing;
+  uint32 Head;
+  uint32 Ps;
+
+  if((TargetCore >= IPC_NUM_CORES) || (TargetCore == get_core_id()) || (Func == NULL))
+  {
+    return(FALSE);
+  }
+
+  pRing = &Ipc_Ring[TargetCore];
+
+  IPC_LOCK(Ps);
+
+  Head = pRing->Head;
+
+  if((Head - pRing->Tail) >= IPC_QUEUE_SIZE)
+  {
+    IPC_UNLOCK(Ps);
+    return(FALSE);
+  }
+
+  pRing->Slot[Head & (IPC_QUEUE_SIZE - 1ul)].Func = Func;
+  pRing->Slot[Head & (IPC_QUEUE_SIZE - 1ul)].Arg  = Arg;
+
+  /* the slot is written before it is published, and published before the interrupt */
+  IPC_BARRIER();
+  pRing->Head = Head + 1ul;
+  IPC_BARRIER();
+
+  Ipc_Raise(TargetCore);
+
+  IPC_UNLOCK(Ps);
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Ipc_GetPending function
+///
+/// \param  TargetCore : 0 or 1
+///
+/// \return calls queued for the core and not started yet
+//-----------------------------------------------------------------------------------------
+uint32 Ipc_GetPending(uint32 TargetCore)
+{
+  return((TargetCore < IPC_NUM_CORES) ? (Ipc_Ring[TargetCore].Head - Ipc_Ring[TargetCore].Tail) : 0ul);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Ipc_Isr function
+///
+/// \descr  Receive interrupt of a core. The request is cleared before the ring is read:
+///         a call published afterwards raises it again, so no call is left behind.
+///         Only the calls present on entry are run, the next ones re-enter.
+///
+/// \param  Arg : receiving core
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void Ipc_Isr(void* Arg)
+{
+  const uint32 Core = (uint32)Arg;
+  Ipc_RingType* pRing = &Ipc_Ring[Core];
+  uint32 Tail;
+  uint32 Head;
+  Ipc_MsgType Msg;
+
+  Ipc_Clear(Core);
+
+  Head = pRing->Head;
+  Tail = pRing->Tail;
+
+  /* the slots are read after the head that published them */
+  IPC_BARRIER();
+
+  while(Tail != Head)
+  {
+    Msg = pRing->Slot[Tail & (IPC_QUEUE_SIZE - 1ul)];
+
+    /* the slot is read before it is given back to the producer */
+    IPC_BARRIER();
+    pRing->Tail = ++Tail;
+
+    Msg.Func(Msg.Arg);
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Ipc_Raise function
+///
+/// \param  TargetCore : 0 or 1
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void Ipc_Raise(uint32 TargetCore)
+{
+  if(TargetCore == 0ul)
+  {
+    SYSTEM->CPU_INTR_FROM_CPU_0.reg = 1ul;
+  }
+  else
+  {
+    SYSTEM->CPU_INTR_FROM_CPU_1.reg = 1ul;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Ipc_Clear function
+///
+/// \param  Core : 0 or 1
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void Ipc_Clear(uint32 Core)
+{
+  if(Core == 0ul)
+  {
+    SYSTEM->CPU_INTR_FROM_CPU_0.reg = 0ul;
+  }
+  else
+  {
+    SYSTEM->CPU_INTR_FROM_CPU_1.reg = 0ul;
+  }
+
+  IPC_BARRIER();
+}
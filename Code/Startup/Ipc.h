@@ -0,0 +1,60 @@
+/******************************************************************************************
+  Filename    : Ipc.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Cross-core function calls (FROM_CPU interrupts and SPSC rings) header file
+
+******************************************************************************************/
+
+#ifndef __IPC_H__
+#define __IPC_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define IPC_NUM_CORES             2ul
+
+/* slots of each ring (power of two) */
+#ifndef IPC_QUEUE_SIZE
+  #define IPC_QUEUE_SIZE          32ul
+#endif
+
+/* priority level of the receive interrupt */
+#define IPC_LEVEL                 2ul
+
+//=============================================================================
+// Types
+//=============================================================================
+
+/* function called on the target core, from its IPC interrupt (level IPC_LEVEL) */
+typedef void (*Ipc_FuncType)(void* Arg);
+
+typedef struct
+{
+  Ipc_FuncType Func;
+  void*        Arg;
+}Ipc_MsgType;
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+boolean Ipc_Init(void);
+void Ipc_Enable(void);
+boolean Ipc_Post(uint32 TargetCore, Ipc_FuncType Func, void* Arg);
+uint32 Ipc_GetPending(uint32 TargetCore);
+
+#endif
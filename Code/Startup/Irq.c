@@ -0,0 +1,270 @@
+/******************************************************************************************
+  Filename    : Irq.c
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Table-driven CPU interrupt dispatcher (per-core handler table)
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Irq.h"
+#include "Crash.h"
+#include "IrqLatency.h"
+#include "core-isa.h"
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define IRQ_READ_INTENABLE(x)     __asm__ volatile ("rsr.intenable %0" : "=r"(x))
+#define IRQ_WRITE_INTENABLE(x)    __asm__ volatile ("wsr.intenable %0\n\trsync" : : "r"(x) : "memory")
+#define IRQ_LOCK(ps)              __asm__ volatile ("rsil %0, 15" : "=r"(ps) : : "memory")
+#define IRQ_UNLOCK(ps)            __asm__ volatile ("wsr.ps %0\n\trsync" : : "r"(ps) : "memory")
+#define IRQ_WRITE_MISC0(x)        __asm__ volatile ("wsr.misc0 %0\n\trsync" : : "r"(x) : "memory")
+#define IRQ_WRITE_MISC1(x)        __asm__ volatile ("wsr.misc1 %0\n\trsync" : : "r"(x) : "memory")
+
+/* index of the highest set bit (x != 0) */
+#define IRQ_NSAU(x, n)            __asm__ ("nsau %0, %1" : "=r"(n) : "r"(x))
+
+//=============================================================================
+// Externs
+//=============================================================================
+extern uint32 get_core_id(void);
+
+//=============================================================================
+// Globals
+//=============================================================================
+static volatile Irq_EntryType Irq_HandlerTable[IRQ_NUM_CORES][IRQ_NUM_CPU_INT];
+
+/* CPU interrupts of each priority level (fixed by the core configuration, in DRAM: read by Irq_Dispatch) */
+static const uint32 Irq_LevelMask[IRQ_NUM_LEVELS + 1ul] DRAM_ATTR =
+{
+  0ul,
+  XCHAL_INTLEVEL1_MASK,
+  XCHAL_INTLEVEL2_MASK,
+  XCHAL_INTLEVEL3_MASK,
+  XCHAL_INTLEVEL4_MASK,
+  XCHAL_INTLEVEL5_MASK,
+  XCHAL_INTLEVEL6_MASK,
+  XCHAL_INTLEVEL7_MASK
+};
+
+//=============================================================================
+// Static functions
+//=============================================================================
+static void Irq_UnhandledInterrupt(uint32 CpuInt);
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Irq_Register function
+///
+/// \descr  Installs the handler of a CPU interrupt in the table of a core. The level
+///         of a CPU interrupt is fixed by the hardware and must match the given level.
+///         The interrupt must be disabled while its entry is replaced.
+///
+/// \param  Core    : core owning the entry (0 or 1)
+///         CpuInt  : CPU interrupt number (0..31)
+///         Level   : priority level of the CPU interrupt (1..IRQ_MAX_LEVEL)
+///         Handler : handler called with Arg
+///         Arg     : handler argument
+///
+/// \return TRUE if the handler is registered
+//-----------------------------------------------------------------------------------------
+boolean Irq_Register(uint32 Core, uint32 CpuInt, uint32 Level, Irq_HandlerType Handler, void* Arg)
+{
+  if((Core >= IRQ_NUM_CORES) || (CpuInt >= IRQ_NUM_CPU_INT) || (Level == 0ul) || (Level > IRQ_MAX_LEVEL) || (Handler == NULL))
+  {
+    return(FALSE);
+  }
+
+  if((Irq_LevelMask[Level] & (1ul << CpuInt)) == 0ul)
+  {
+    return(FALSE);
+  }
+
+  Irq_HandlerTable[Core][CpuInt].Arg     = Arg;
+  Irq_HandlerTable[Core][CpuInt].Handler = Handler;
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Irq_Unregister function
+///
+/// \descr  Disables the CPU interrupt before removing its entry, so a later assertion of
+///         the line does not reach the unregistered vector path. Only the owning core can
+///         disable it (INTENABLE is per core).
+///
+/// \param  Core   : core owning the entry (the calling core)
+///         CpuInt : CPU interrupt number (0..31)
+///
+/// \return TRUE if the entry is removed
+//-----------------------------------------------------------------------------------------
+boolean Irq_Unregister(uint32 Core, uint32 CpuInt)
+{
+  if((Core != get_core_id()) || (CpuInt >= IRQ_NUM_CPU_INT))
+  {
+    return(FALSE);
+  }
+
+  Irq_Disable(CpuInt);
+
+  Irq_HandlerTable[Core][CpuInt].Handler = NULL;
+  Irq_HandlerTable[Core][CpuInt].Arg     = NULL;
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Irq_Enable function
+///
+/// \param  CpuInt : CPU interrupt number of the calling core
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR void Irq_Enable(uint32 CpuInt)
+{
+  uint32 Ps;
+  uint32 IntEnable;
+
+  IRQ_LOCK(Ps);
+  IRQ_READ_INTENABLE(IntEnable);
+  IntEnable |= (1ul << (CpuInt & (IRQ_NUM_CPU_INT - 1ul)));
+  IRQ_WRITE_INTENABLE(IntEnable);
+  IRQ_UNLOCK(Ps);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Irq_Disable function
+///
+/// \param  CpuInt : CPU interrupt number of the calling core
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR void Irq_Disable(uint32 CpuInt)
+{
+  uint32 Ps;
+  uint32 IntEnable;
+
+  IRQ_LOCK(Ps);
+  IRQ_READ_INTENABLE(IntEnable);
+  IntEnable &= ~(1ul << (CpuInt & (IRQ_NUM_CPU_INT - 1ul)));
+  IRQ_WRITE_INTENABLE(IntEnable);
+  IRQ_UNLOCK(Ps);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Irq_Dispatch function
+///
+/// \descr  Runs the handler of each enabled and pending CPU interrupt of the level,
+///         the highest numbered first. Each source is found with one nsau, so the
+///         cost does not depend on the number of registered handlers.
+///
+/// \param  Level   : level of the interrupt vector
+///         Pending : INTERRUPT special register read by the vector
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR void Irq_Dispatch(uint32 Level, uint32 Pending)
+{
+  const uint32 Core = get_core_id();
+  uint32 IntEnable;
+  uint32 Active;
+
+#ifdef IRQ_LATENCY_ENABLED
+  const uint32 EntryStamp = IrqLatency_ReadEntryStamp(Level);
+#endif
+
+  IRQ_READ_INTENABLE(IntEnable);
+
+  Active = Pending & IntEnable & Irq_LevelMask[Level & IRQ_NUM_LEVELS];
+
+  while(Active != 0ul)
+  {
+    uint32 Nsa;
+    uint32 CpuInt;
+
+    IRQ_NSAU(Active, Nsa);
+
+    CpuInt  = (IRQ_NUM_CPU_INT - 1ul) - Nsa;
+    Active &= ~(1ul << CpuInt);
+
+    if(Irq_HandlerTable[Core][CpuInt].Handler != NULL)
+    {
+#ifdef IRQ_LATENCY_ENABLED
+      IrqLatency_Record(Core, Level, CpuInt, EntryStamp);
+#endif
+      Irq_HandlerTable[Core][CpuInt].Handler(Irq_HandlerTable[Core][CpuInt].Arg);
+    }
+    else
+    {
+      Irq_UnhandledInterrupt(CpuInt);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Irq_GetLevelMask function
+///
+/// \param  Level : priority level (1..7)
+///
+/// \return bitmap of the CPU interrupts of the level
+//-----------------------------------------------------------------------------------------
+uint32 Irq_GetLevelMask(uint32 Level)
+{
+  return((Level <= IRQ_NUM_LEVELS) ? Irq_LevelMask[Level] : 0ul);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Irq_RegisterFast function
+///
+/// \descr  Installs a fast handler on the level 4 or level 5 vector of the calling core.
+///         The vector calls it directly instead of saving the context and running
+///         Irq_Dispatch, so the handler serves every CPU interrupt of the level and
+///         must clear its source itself.
+///
+/// \param  Level   : 4 or 5
+///         Handler : fast handler (NULL: back to Irq_Dispatch)
+///
+/// \return TRUE if the handler is installed
+//-----------------------------------------------------------------------------------------
+boolean Irq_RegisterFast(uint32 Level, Irq_FastHandlerType Handler)
+{
+  const uint32 Address = (uint32)Handler;
+
+  if(Level == 4ul)
+  {
+    IRQ_WRITE_MISC0(Address);
+  }
+  else if(Level == 5ul)
+  {
+    IRQ_WRITE_MISC1(Address);
+  }
+  else
+  {
+    return(FALSE);
+  }
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Irq_UnhandledInterrupt function
+///
+/// \param  CpuInt : enabled CPU interrupt without handler
+///
+/// \return void (the chip is reset with a crash record)
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void Irq_UnhandledInterrupt(uint32 CpuInt)
+{
+  Crash_Panic(CRASH_PANIC_UNHANDLED_IRQ, CpuInt);
+}
@@ -0,0 +1,62 @@
+/******************************************************************************************
+  Filename    : Irq.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Table-driven CPU interrupt dispatcher header file
+
+******************************************************************************************/
+
+#ifndef __IRQ_H__
+#define __IRQ_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define IRQ_NUM_CORES             2ul
+#define IRQ_NUM_CPU_INT           32ul
+#define IRQ_NUM_LEVELS            7ul
+
+/* highest dispatched level (level 6 is the debug level, level 7 is the NMI) */
+#define IRQ_MAX_LEVEL             5ul
+
+//=============================================================================
+// Types
+//=============================================================================
+typedef void (*Irq_HandlerType)(void* Arg);
+
+/* fast handler: assembly leaf function called with callx0 from the level 4/5 vector,
+   a0 holds the return address and every other register (a1..a15, SAR, LOOP) must be preserved */
+typedef void (*Irq_FastHandlerType)(void);
+
+typedef struct
+{
+  Irq_HandlerType Handler;
+  void*           Arg;
+}Irq_EntryType;
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+boolean Irq_Register(uint32 Core, uint32 CpuInt, uint32 Level, Irq_HandlerType Handler, void* Arg);
+boolean Irq_Unregister(uint32 Core, uint32 CpuInt);
+void Irq_Enable(uint32 CpuInt);
+void Irq_Disable(uint32 CpuInt);
+void Irq_Dispatch(uint32 Level, uint32 Pending);
+uint32 Irq_GetLevelMask(uint32 Level);
+boolean Irq_RegisterFast(uint32 Level, Irq_FastHandlerType Handler);
+
+#endif
@@ -0,0 +1,264 @@
+/******************************************************************************************
+  Filename    : IrqLatency.c
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Interrupt latency histograms of the CPU timer interrupts (IRQ_LATENCY=1)
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "IrqLatency.h"
+#include "core-isa.h"
+#include "printf.h"
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define IRQ_LATENCY_READ_CCOUNT(x)        __asm__ volatile ("rsr.ccount %0" : "=r"(x))
+#define IRQ_LATENCY_READ_SR(sr, x)        __asm__ volatile ("rsr." #sr " %0" : "=r"(x))
+#define IRQ_LATENCY_LOCK(ps)              __asm__ volatile ("rsil %0, 15" : "=r"(ps) : : "memory")
+#define IRQ_LATENCY_UNLOCK(ps)            __asm__ volatile ("wsr.ps %0\n\trsync" : : "r"(ps) : "memory")
+
+//=============================================================================
+// Externs
+//=============================================================================
+extern uint32 get_core_id(void);
+
+//=============================================================================
+// Globals
+//=============================================================================
+static IrqLatency_StatsType IrqLatency_Stats[IRQ_LATENCY_NUM_CORES][IRQ_LATENCY_NUM_LEVELS];
+
+//=============================================================================
+// Static functions
+//=============================================================================
+static boolean IrqLatency_GetDeadline(uint32 CpuInt, uint32* pDeadline);
+static void IrqLatency_Add(IrqLatency_HistType* pHist, uint32 Cycles);
+static void IrqLatency_PrintHist(uint32 Core, uint32 Level, const char* Kind, const IrqLatency_HistType* pHist);
+
+//-----------------------------------------------------------------------------------------
+/// \brief  IrqLatency_ReadEntryStamp function
+///
+/// \descr  CCOUNT stored by call_isr in the EXCSAVE register of the level at the vector
+///         entry. Must be read before the first handler runs (a level 1 handler using
+///         the FPU overwrites EXCSAVE1 in the coprocessor exception).
+///
+/// \param  Level : level of the interrupt vector (1..IRQ_LATENCY_NUM_LEVELS)
+///
+/// \return CCOUNT at the vector entry
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR uint32 IrqLatency_ReadEntryStamp(uint32 Level)
+{
+  uint32 Stamp = 0ul;
+
+  switch(Level)
+  {
+    case 1ul: IRQ_LATENCY_READ_SR(excsave1, Stamp); break;
+    case 2ul: IRQ_LATENCY_READ_SR(excsave2, Stamp); break;
+    case 3ul: IRQ_LATENCY_READ_SR(excsave3, Stamp); break;
+    case 4ul: IRQ_LATENCY_READ_SR(excsave4, Stamp); break;
+    case 5ul: IRQ_LATENCY_READ_SR(excsave5, Stamp); break;
+    default: break;
+  }
+
+  return(Stamp);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  IrqLatency_Record function
+///
+/// \descr  Called by Irq_Dispatch right before the handler of a CPU interrupt. Only the
+///         CPU timers have a known deadline: CCOMPAREn still holds the match value until
+///         the handler reloads it.
+///
+/// \param  Core       : core running the dispatcher
+///         Level      : level of the interrupt vector
+///         CpuInt     : CPU interrupt about to be handled
+///         EntryStamp : CCOUNT at the vector entry (IrqLatency_ReadEntryStamp)
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR void IrqLatency_Record(uint32 Core, uint32 Level, uint32 CpuInt, uint32 EntryStamp)
+{
+  uint32 Now;
+  uint32 Deadline;
+
+  IRQ_LATENCY_READ_CCOUNT(Now);
+
+  if((Core >= IRQ_LATENCY_NUM_CORES) || (Level == 0ul) || (Level > IRQ_LATENCY_NUM_LEVELS) || (IrqLatency_GetDeadline(CpuInt, &Deadline) == FALSE))
+  {
+    return;
+  }
+
+  IrqLatency_Add(&IrqLatency_Stats[Core][Level - 1ul].Entry, EntryStamp - Deadline);
+  IrqLatency_Add(&IrqLatency_Stats[Core][Level - 1ul].Handler, Now - Deadline);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  IrqLatency_GetStats function
+///
+/// \param  Core   : 0 or 1
+///         Level  : interrupt level (1..IRQ_LATENCY_NUM_LEVELS)
+///         pStats : copy of the histograms of the level
+///
+/// \return TRUE if the statistics are copied
+//-----------------------------------------------------------------------------------------
+boolean IrqLatency_GetStats(uint32 Core, uint32 Level, IrqLatency_StatsType* pStats)
+{
+  uint32 Ps;
+
+  if((Core >= IRQ_LATENCY_NUM_CORES) || (Level == 0ul) || (Level > IRQ_LATENCY_NUM_LEVELS) || (pStats == NULL))
+  {
+    return(FALSE);
+  }
+
+  /* note: a consistent copy on the own core only, the other core may update it meanwhile */
+  IRQ_LATENCY_LOCK(Ps);
+  *pStats = IrqLatency_Stats[Core][Level - 1ul];
+  IRQ_LATENCY_UNLOCK(Ps);
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  IrqLatency_Reset function
+///
+/// \descr  Clears the histograms of a core, e.g. before measuring a new scenario.
+///
+/// \param  Core : 0 or 1
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void IrqLatency_Reset(uint32 Core)
+{
+  uint32 Ps;
+
+  if(Core >= IRQ_LATENCY_NUM_CORES)
+  {
+    return;
+  }
+
+  IRQ_LATENCY_LOCK(Ps);
+
+  for(uint32 level = 0; level < IRQ_LATENCY_NUM_LEVELS; level++)
+  {
+    IrqLatency_Stats[Core][level] = (IrqLatency_StatsType){0};
+  }
+
+  IRQ_LATENCY_UNLOCK(Ps);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  IrqLatency_Print function
+///
+/// \descr  Prints the non-empty histograms in the following format:
+///           IRQLAT <core> <level> <ENTRY|HANDLER> <count> <min> <max> <avg> <bin0..bin15>
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+COLD_ATTR void IrqLatency_Print(void)
+{
+  for(uint32 core = 0; core < IRQ_LATENCY_NUM_CORES; core++)
+  {
+    for(uint32 level = 1; level <= IRQ_LATENCY_NUM_LEVELS; level++)
+    {
+      IrqLatency_StatsType Stats;
+
+      (void)IrqLatency_GetStats(core, level, &Stats);
+
+      IrqLatency_PrintHist(core, level, "ENTRY", &Stats.Entry);
+      IrqLatency_PrintHist(core, level, "HANDLER", &Stats.Handler);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  IrqLatency_GetDeadline function
+///
+/// \param  CpuInt    : CPU interrupt
+///         pDeadline : CCOUNT value at which the interrupt was raised
+///
+/// \return TRUE for the CPU timer interrupts
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR boolean IrqLatency_GetDeadline(uint32 CpuInt, uint32* pDeadline)
+{
+  switch(CpuInt)
+  {
+    case XCHAL_TIMER0_INTERRUPT: IRQ_LATENCY_READ_SR(ccompare0, *pDeadline); return(TRUE);
+    case XCHAL_TIMER1_INTERRUPT: IRQ_LATENCY_READ_SR(ccompare1, *pDeadline); return(TRUE);
+    case XCHAL_TIMER2_INTERRUPT: IRQ_LATENCY_READ_SR(ccompare2, *pDeadline); return(TRUE);
+    default: return(FALSE);
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  IrqLatency_Add function
+///
+/// \param  pHist  : histogram
+///         Cycles : latency in CPU cycles
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void IrqLatency_Add(IrqLatency_HistType* pHist, uint32 Cycles)
+{
+  uint32 Bin = (Cycles == 0ul) ? 0ul : (32ul - (uint32)__builtin_clz(Cycles));
+
+  if(Bin >= IRQ_LATENCY_NUM_BINS)
+  {
+    Bin = IRQ_LATENCY_NUM_BINS - 1ul;
+  }
+
+  if((pHist->Count == 0ul) || (Cycles < pHist->Min))
+  {
+    pHist->Min = Cycles;
+  }
+
+  if(Cycles > pHist->Max)
+  {
+    pHist->Max = Cycles;
+  }
+
+  pHist->Count++;
+  pHist->Sum += Cycles;
+  pHist->Bin[Bin]++;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  IrqLatency_PrintHist function
+///
+/// \param  Core  : core of the histogram
+///         Level : level of the histogram
+///         Kind  : "ENTRY" or "HANDLER"
+///         pHist : histogram (skipped when empty)
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static COLD_ATTR void IrqLatency_PrintHist(uint32 Core, uint32 Level, const char* Kind, const IrqLatency_HistType* pHist)
+{
+  if(pHist->Count == 0ul)
+  {
+    return;
+  }
+
+  printf("IRQLAT %lu %lu %s %lu %lu %lu %lu", Core, Level, Kind, pHist->Count, pHist->Min, pHist->Max, (uint32)(pHist->Sum / pHist->Count));
+
+  for(uint32 bin = 0; bin < IRQ_LATENCY_NUM_BINS; bin++)
+  {
+    printf(" %lu", pHist->Bin[bin]);
+  }
+
+  printf("\r\n");
+}
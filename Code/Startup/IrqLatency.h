@@ -0,0 +1,64 @@
+/******************************************************************************************
+  Filename    : IrqLatency.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Interrupt latency histograms of the CPU timer interrupts header file
+
+******************************************************************************************/
+
+#ifndef __IRQ_LATENCY_H__
+#define __IRQ_LATENCY_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define IRQ_LATENCY_NUM_CORES     2ul
+#define IRQ_LATENCY_NUM_LEVELS    5ul
+
+/* log2 histogram: bin n counts the latencies of n significant bits (bin 0: 0 cycles),
+   the last bin also counts everything above */
+#define IRQ_LATENCY_NUM_BINS      16ul
+
+//=============================================================================
+// Types
+//=============================================================================
+typedef struct
+{
+  uint32 Count;
+  uint32 Min;
+  uint32 Max;
+  uint64 Sum;
+  uint32 Bin[IRQ_LATENCY_NUM_BINS];
+}IrqLatency_HistType;
+
+/* latencies in CPU cycles from the CCOMPARE match */
+typedef struct
+{
+  IrqLatency_HistType Entry;      /* to the vector entry (first instruction of call_isr) */
+  IrqLatency_HistType Handler;    /* to the start of the registered handler */
+}IrqLatency_StatsType;
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+uint32 IrqLatency_ReadEntryStamp(uint32 Level);
+void IrqLatency_Record(uint32 Core, uint32 Level, uint32 CpuInt, uint32 EntryStamp);
+boolean IrqLatency_GetStats(uint32 Core, uint32 Level, IrqLatency_StatsType* pStats);
+void IrqLatency_Reset(uint32 Core);
+void IrqLatency_Print(void);
+
+#endif
@@ -0,0 +1,334 @@
+/******************************************************************************************
+  Filename    : Stack.c
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Stack watermark (stack painting) and overflow guard (ASSIST_DEBUG SP monitor)
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Stack.h"
+#include "Crash.h"
+#include "esp32s3.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* distance kept between the painted area and the stack pointer of Stack_Paint */
+#define STACK_PAINT_MARGIN        32ul
+
+/* CPU interrupt 14 is the non-maskable interrupt (level 7) */
+#define STACK_GUARD_CPU_INT       14ul
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define STACK_READ_SP(x)          __asm__ volatile ("mov %0, sp" : "=r"(x))
+#define STACK_READ_PRID(x)        __asm__ volatile ("rsr.prid %0" : "=r"(x))
+
+/* PRID is 0xCDCD on core 0 and 0xABAB on core 1 */
+#define STACK_CORE_ID(prid)       (((prid) >> 13) & 1ul)
+
+//=============================================================================
+// Externs
+//=============================================================================
+extern unsigned long __CORE0_STACK_BOTTOM[];
+extern unsigned long __CORE0_STACK_TOP[];
+extern unsigned long __CORE1_STACK_BOTTOM[];
+extern unsigned long __CORE1_STACK_TOP[];
+
+//=============================================================================
+// Static functions
+//=============================================================================
+static uint32 Stack_GetCoreId(void);
+static uint32 Stack_GetBottom(uint32 Core);
+static uint32 Stack_GetTop(uint32 Core);
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Stack_Paint function
+///
+/// \descr  Fills the unused part of the stack of the calling core with STACK_PAINT_PATTERN.
+///         Must be called with the interrupts disabled (nothing may live below SP).
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+__attribute__((noinline)) void Stack_Paint(void)
+{
+  const uint32 Core = Stack_GetCoreId();
+  uint32 Sp;
+
+  STACK_READ_SP(Sp);
+
+  for(volatile uint32* pWord = (volatile uint32*)Stack_GetBottom(Core); (uint32)pWord < (Sp - STACK_PAINT_MARGIN); pWord++)
+  {
+    *pWord = STACK_PAINT_PATTERN;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Stack_EnableGuard function
+///
+/// \descr  Programs the stack pointer monitor of the calling core to [bottom + guard, top]
+///         and routes its interrupt to the NMI. The guard band leaves room for the NMI
+///         handler to run on the overflowed stack.
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void Stack_EnableGuard(void)
+{
+  const uint32 Core   = Stack_GetCoreId();
+  const uint32 SpMin  = Stack_GetBottom(Core) + STACK_GUARD_SIZE;
+  const uint32 SpMax  = Stack_GetTop(Core);
+
+  SYSTEM->CPU_PERI_CLK_EN.bit.CLK_EN_ASSIST_DEBUG = 1;
+  SYSTEM->CPU_PERI_RST_EN.bit.RST_EN_ASSIST_DEBUG = 0;
+
+  if(Core == STACK_CORE0)
+  {
+    ASSIST_DEBUG->CORE_0_INTR_ENA.bit.CORE_0_SP_SPILL_MIN_INTR_ENA = 0;
+    ASSIST_DEBUG->CORE_0_INTR_ENA.bit.CORE_0_SP_SPILL_MAX_INTR_ENA = 0;
+
+    ASSIST_DEBUG->CORE_0_SP_MIN.reg = SpMin;
+    ASSIST_DEBUG->CORE_0_SP_MAX.reg = SpMax;
+
+    ASSIST_DEBUG->CORE_0_INTR_CLR.bit.CORE_0_SP_SPILL_MIN_CLR = 1;
+    ASSIST_DEBUG->CORE_0_INTR_CLR.bit.CORE_0_SP_SPILL_MAX_CLR = 1;
+
+    ASSIST_DEBUG->CORE_0_MONTR_ENA.bit.CORE_0_SP_SPILL_MIN_ENA = 1;
+    ASSIST_DEBUG->CORE_0_MONTR_ENA.bit.CORE_0_SP_SPILL_MAX_ENA = 1;
+
+    INTERRUPT_CORE0->ASSIST_DEBUG_INTR_MAP.bit.ASSIST_DEBUG_INTR_MAP = STACK_GUARD_CPU_INT;
+
+    ASSIST_DEBUG->CORE_0_INTR_ENA.bit.CORE_0_SP_SPILL_MIN_INTR_ENA = 1;
+    ASSIST_DEBUG->CORE_0_INTR_ENA.bit.CORE_0_SP_SPILL_MAX_INTR_ENA = 1;
+  }
+  else
+  {
+    ASSIST_DEBUG->CORE_1_INTR_ENA.bit.CORE_1_SP_SPILL_MIN_INTR_ENA = 0;
+    ASSIST_DEBUG->CORE_1_INTR_ENA.bit.CORE_1_SP_SPILL_MAX_INTR_ENA = 0;
+
+    ASSIST_DEBUG->CORE_1_SP_MIN.reg = SpMin;
+    ASSIST_DEBUG->CORE_1_SP_MAX.reg = SpMax;
+
+    ASSIST_DEBUG->CORE_1_INTR_CLR.bit.CORE_1_SP_SPILL_MIN_CLR = 1;
+    ASSIST_DEBUG->CORE_1_INTR_CLR.bit.CORE_1_SP_SPILL_MAX_CLR = 1;
+
+    ASSIST_DEBUG->CORE_1_MONTR_ENA.bit.CORE_1_SP_SPILL_MIN_ENA = 1;
+    ASSIST_DEBUG->CORE_1_MONTR_ENA.bit.CORE_1_SP_SPILL_MAX_ENA = 1;
+
+    INTERRUPT_CORE1->ASSIST_DEBUG_INTR_MAP.bit.ASSIST_DEBUG_INTR_MAP = STACK_GUARD_CPU_INT;
+
+    ASSIST_DEBUG->CORE_1_INTR_ENA.bit.CORE_1_SP_SPILL_MIN_INTR_ENA = 1;
+    ASSIST_DEBUG->CORE_1_INTR_ENA.bit.CORE_1_SP_SPILL_MAX_INTR_ENA = 1;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Stack_SuspendGuard function
+///
+/// \descr  Stops the stack pointer monitor of the calling core while SP moves to
+///         another stack (see Stack_SetGuard).
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR void Stack_SuspendGuard(void)
+{
+  if(Stack_GetCoreId() == STACK_CORE0)
+  {
+    ASSIST_DEBUG->CORE_0_MONTR_ENA.bit.CORE_0_SP_SPILL_MIN_ENA = 0;
+    ASSIST_DEBUG->CORE_0_MONTR_ENA.bit.CORE_0_SP_SPILL_MAX_ENA = 0;
+  }
+  else
+  {
+    ASSIST_DEBUG->CORE_1_MONTR_ENA.bit.CORE_1_SP_SPILL_MIN_ENA = 0;
+    ASSIST_DEBUG->CORE_1_MONTR_ENA.bit.CORE_1_SP_SPILL_MAX_ENA = 0;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Stack_SetGuard function
+///
+/// \descr  Moves the stack pointer monitor of the calling core to another stack (a task
+///         stack of the scheduler) and restarts it. SP must already be on that stack.
+///         The interrupt routing of Stack_EnableGuard is kept.
+///
+/// \param  Bottom : lowest address of the stack
+///         Top    : end address of the stack
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR void Stack_SetGuard(uint32 Bottom, uint32 Top)
+{
+  if(Stack_GetCoreId() == STACK_CORE0)
+  {
+    ASSIST_DEBUG->CORE_0_SP_MIN.reg = Bottom + STACK_GUARD_SIZE;
+    ASSIST_DEBUG->CORE_0_SP_MAX.reg = Top;
+
+    ASSIST_DEBUG->CORE_0_INTR_CLR.bit.CORE_0_SP_SPILL_MIN_CLR = 1;
+    ASSIST_DEBUG->CORE_0_INTR_CLR.bit.CORE_0_SP_SPILL_MAX_CLR = 1;
+
+    ASSIST_DEBUG->CORE_0_MONTR_ENA.bit.CORE_0_SP_SPILL_MIN_ENA = 1;
+    ASSIST_DEBUG->CORE_0_MONTR_ENA.bit.CORE_0_SP_SPILL_MAX_ENA = 1;
+  }
+  else
+  {
+    ASSIST_DEBUG->CORE_1_SP_MIN.reg = Bottom + STACK_GUARD_SIZE;
+    ASSIST_DEBUG->CORE_1_SP_MAX.reg = Top;
+
+    ASSIST_DEBUG->CORE_1_INTR_CLR.bit.CORE_1_SP_SPILL_MIN_CLR = 1;
+    ASSIST_DEBUG->CORE_1_INTR_CLR.bit.CORE_1_SP_SPILL_MAX_CLR = 1;
+
+    ASSIST_DEBUG->CORE_1_MONTR_ENA.bit.CORE_1_SP_SPILL_MIN_ENA = 1;
+    ASSIST_DEBUG->CORE_1_MONTR_ENA.bit.CORE_1_SP_SPILL_MAX_ENA = 1;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Stack_GetSize function
+///
+/// \param  Core : STACK_CORE0 or STACK_CORE1
+///
+/// \return stack size in bytes (STACK_SIZE_COREx of the Makefile)
+//-----------------------------------------------------------------------------------------
+uint32 Stack_GetSize(uint32 Core)
+{
+  return(Stack_GetTop(Core) - Stack_GetBottom(Core));
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Stack_GetHighWaterMark function
+///
+/// \param  Core : STACK_CORE0 or STACK_CORE1
+///
+/// \return maximum stack usage in bytes since Stack_Paint
+//-----------------------------------------------------------------------------------------
+uint32 Stack_GetHighWaterMark(uint32 Core)
+{
+  const volatile uint32* pWord = (const volatile uint32*)Stack_GetBottom(Core);
+  const uint32 Top = Stack_GetTop(Core);
+
+  while(((uint32)pWord < Top) && (*pWord == STACK_PAINT_PATTERN))
+  {
+    pWord++;
+  }
+
+  return(Top - (uint32)pWord);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Stack_GetOverflowPc function
+///
+/// \param  Core : STACK_CORE0 or STACK_CORE1
+///
+/// \return PC of the first instruction that moved SP out of the guarded range
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR uint32 Stack_GetOverflowPc(uint32 Core)
+{
+  return((Core == STACK_CORE0) ? ASSIST_DEBUG->CORE_0_SP_PC.reg : ASSIST_DEBUG->CORE_1_SP_PC.reg);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Stack_IsOverflowPending function
+///
+/// \param  void
+///
+/// \return TRUE if the stack monitor of the calling core has triggered
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR boolean Stack_IsOverflowPending(void)
+{
+  if(Stack_GetCoreId() == STACK_CORE0)
+  {
+    return(((ASSIST_DEBUG->CORE_0_INTR_RAW.bit.CORE_0_SP_SPILL_MIN_RAW != 0) ||
+            (ASSIST_DEBUG->CORE_0_INTR_RAW.bit.CORE_0_SP_SPILL_MAX_RAW != 0)) ? TRUE : FALSE);
+  }
+  else
+  {
+    return(((ASSIST_DEBUG->CORE_1_INTR_RAW.bit.CORE_1_SP_SPILL_MIN_RAW != 0) ||
+            (ASSIST_DEBUG->CORE_1_INTR_RAW.bit.CORE_1_SP_SPILL_MAX_RAW != 0)) ? TRUE : FALSE);
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Stack_OverflowHandler function
+///
+/// \descr  Called from the NMI on a stack overflow. The RAM below the stack is already
+///         corrupted, the state of the core goes to its crash record (the faulting PC
+///         from SP_PC is the panic argument) and the chip is reset.
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR void Stack_OverflowHandler(void)
+{
+  const uint32 Core = Stack_GetCoreId();
+
+  if(Core == STACK_CORE0)
+  {
+    ASSIST_DEBUG->CORE_0_MONTR_ENA.reg = 0ul;
+  }
+  else
+  {
+    ASSIST_DEBUG->CORE_1_MONTR_ENA.reg = 0ul;
+  }
+
+  Crash_Panic(CRASH_PANIC_STACK_OVERFLOW, Stack_GetOverflowPc(Core));
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Stack_GetCoreId function
+///
+/// \param  void
+///
+/// \return core executing the function
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR uint32 Stack_GetCoreId(void)
+{
+  uint32 Prid;
+
+  STACK_READ_PRID(Prid);
+
+  return(STACK_CORE_ID(Prid));
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Stack_GetBottom function
+///
+/// \param  Core : STACK_CORE0 or STACK_CORE1
+///
+/// \return lowest address of the stack
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR uint32 Stack_GetBottom(uint32 Core)
+{
+  return((Core == STACK_CORE0) ? (uint32)&__CORE0_STACK_BOTTOM[0] : (uint32)&__CORE1_STACK_BOTTOM[0]);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Stack_GetTop function
+///
+/// \param  Core : STACK_CORE0 or STACK_CORE1
+///
+/// \return end address of the stack (initial SP)
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR uint32 Stack_GetTop(uint32 Core)
+{
+  return((Core == STACK_CORE0) ? (uint32)&__CORE0_STACK_TOP[0] : (uint32)&__CORE1_STACK_TOP[0]);
+}
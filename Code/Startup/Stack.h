@@ -0,0 +1,53 @@
+/******************************************************************************************
+  Filename    : Stack.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Stack watermark and overflow guard header file
+
+******************************************************************************************/
+
+#ifndef __STACK_H__
+#define __STACK_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define STACK_CORE0               0ul
+#define STACK_CORE1               1ul
+
+/* pattern painted on the unused stack area */
+#define STACK_PAINT_PATTERN       0xA5A5A5A5ul
+
+/* lower part of the stack reserved to the overflow handler (the monitor traps when SP enters it) */
+#ifndef STACK_GUARD_SIZE
+  #define STACK_GUARD_SIZE        512ul
+#endif
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+void Stack_Paint(void);
+void Stack_EnableGuard(void);
+void Stack_SuspendGuard(void);
+void Stack_SetGuard(uint32 Bottom, uint32 Top);
+uint32 Stack_GetSize(uint32 Core);
+uint32 Stack_GetHighWaterMark(uint32 Core);
+uint32 Stack_GetOverflowPc(uint32 Core);
+boolean Stack_IsOverflowPending(void);
+void Stack_OverflowHandler(void);
+
+#endif
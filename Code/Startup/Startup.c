@@ -11,6 +11,10 @@
 // 
 // ***************************************************************************************
 #include <stdint.h>
+#include "core-isa.h"
+#include "Platform_Types.h"
+#include "BootProfile.h"
+#include "Stack.h"
 //=========================================================================================
 // types definitions
 //=========================================================================================
@@ -32,35 +36,90 @@ typedef struct
 //=========================================================================================
 extern const runtimeCopyTable_t __RUNTIME_COPY_TABLE[];
 extern const runtimeClearTable_t __RUNTIME_CLEAR_TABLE[];
+extern const runtimeClearTable_t __RUNTIME_COLD_CLEAR_TABLE[];
+extern const runtimeCopyTable_t __OVERLAY_TABLE[];
+extern const runtimeClearTable_t __CORE1_CLEAR_TABLE[];
 extern unsigned long __CPPCTOR_LIST__[];
+extern unsigned long __CORE1_CTOR_LIST__[];
+extern void _vector_table(void);
 
 //=========================================================================================
 // defines
 //=========================================================================================
 #define __STARTUP_RUNTIME_COPYTABLE   (runtimeCopyTable_t*)(&__RUNTIME_COPY_TABLE[0])
 #define __STARTUP_RUNTIME_CLEARTABLE  (runtimeClearTable_t*)(&__RUNTIME_CLEAR_TABLE[0])
+#define __STARTUP_COLD_CLEARTABLE     (runtimeClearTable_t*)(&__RUNTIME_COLD_CLEAR_TABLE[0])
 #define __STARTUP_RUNTIME_CTORS       (unsigned long*)(&__CPPCTOR_LIST__[0])
+#define __STARTUP_OVERLAY_TABLE       (runtimeCopyTable_t*)(&__OVERLAY_TABLE[0])
+#define __STARTUP_CORE1_CLEARTABLE    (runtimeClearTable_t*)(&__CORE1_CLEAR_TABLE[0])
+#define __STARTUP_CORE1_CTORS         (unsigned long*)(&__CORE1_CTOR_LIST__[0])
 
 //=========================================================================================
 // function prototype
 //=========================================================================================
 void Startup_Init(void) __attribute__((used));
+void Startup_Init_c1(void) __attribute__((used));
+void Startup_ReleaseCore1(void);
+boolean Startup_LoadOverlay(unsigned long OverlayId);
 static void Startup_InitRam(void);
+static void Startup_InitRamShare(unsigned long Share, unsigned long ShareCount);
+static void Startup_ClearTableShare(const runtimeClearTable_t* ClearTable, unsigned long Share, unsigned long ShareCount);
+static void Startup_StartCore1(void);
+static void Startup_ClearRegion(unsigned long Addr, unsigned long Size) __attribute__((noinline));
+static void Startup_CopyRegion(unsigned long Source, unsigned long Target, unsigned long Size);
 static void Startup_InitCtors(void);
+static void Startup_RunCtorList(const unsigned long* CtorList);
+static void Startup_CheckCore1Vectors(void);
+static void Startup_InitCore1Ram(void);
+static void Startup_InitCore1Ctors(void);
 static void Startup_RunApplication(void);
 static void Startup_Unexpected_Exit(void);
 static void Startup_InitSystemClock(void);
 static void Startup_InitCore(void);
+static void Startup_InitFlashCache(void);
+static void Startup_RunWakeHook(void);
+static void Startup_InitStack(void);
 //=========================================================================================
 // extern function prototype
 //=========================================================================================
 int main(void) __attribute__((weak));
+void main_c1(void) __attribute__((weak));
 void Mcu_ClockInit(void) __attribute__((weak));
 void Mcu_InitCore(void) __attribute__((weak));
+void Mcu_StartCore1(void) __attribute__((weak));
+void Cache_InitFlashXip(void) __attribute__((weak));
+void Startup_InitCore1(void) __attribute__((weak));
+boolean Mcu_IsWarmReset(void) __attribute__((weak));
+boolean DeepSleep_RunWakeHook(void) __attribute__((weak));
 
 //=========================================================================================
 // macros
 //=========================================================================================
+#define STARTUP_READ_CCOUNT(x)  __asm__ volatile ("rsr.ccount %0" : "=r"(x))
+#define STARTUP_READ_VECBASE(x) __asm__ volatile ("rsr.vecbase %0" : "=r"(x))
+#define STARTUP_WRITE_VECBASE(x) __asm__ volatile ("wsr.vecbase %0\n\tisync" : : "r"(x) : "memory")
+
+#define STARTUP_CORE0                 0ul
+#define STARTUP_CORE1                 1ul
+#define STARTUP_RAM_SHARE_ALIGN       16ul
+#define STARTUP_OVERLAY_NUM           4ul
+#define STARTUP_OVERLAY_NONE          ((unsigned long)-1)
+
+//=========================================================================================
+// globals
+//=========================================================================================
+volatile unsigned long Startup_RamInitCycles;
+
+/* core synchronization flags (note: placed in .data as they are used while .bss is being cleared) */
+static volatile unsigned long Startup_RamShareCount     __attribute__((section(".data"))) = 1ul;
+static volatile unsigned long Startup_Core0RamInitDone  __attribute__((section(".data"))) = 0ul;
+static volatile unsigned long Startup_Core1RamInitDone  __attribute__((section(".data"))) = 0ul;
+static volatile unsigned long Startup_Core1Released     __attribute__((section(".data"))) = 0ul;
+static volatile unsigned long Startup_WarmReset         __attribute__((section(".data"))) = 0ul;
+static volatile unsigned long Startup_DeepSleepWake     __attribute__((section(".data"))) = 0ul;
+
+/* overlay currently loaded in the IRAM overlay window */
+static volatile unsigned long Startup_LoadedOverlay     __attribute__((section(".data"))) = STARTUP_OVERLAY_NONE;
 
 //-----------------------------------------------------------------------------------------
 /// \brief  Startup_Init function
@@ -71,23 +130,158 @@ void Mcu_InitCore(void) __attribute__((weak));
 //-----------------------------------------------------------------------------------------
 void Startup_Init(void)
 {
+  /* Run the deep-sleep early wake hook (does not return if the device goes back to sleep) */
+  Startup_RunWakeHook();
+
+  /* Open the boot profile record */
+  BootProfile_Start();
+
   /* Initialize the CPU Core */
   Startup_InitCore();
+  BootProfile_Mark(BOOT_PROFILE_INIT_CORE);
 
   /* Configure the system clock */
   Startup_InitSystemClock();
+  BootProfile_Mark(BOOT_PROFILE_INIT_CLOCK);
+
+  /* Map the flash code and read-only data (XIP mode only) */
+  Startup_InitFlashCache();
+  BootProfile_Mark(BOOT_PROFILE_INIT_FLASH_CACHE);
+
+  /* Paint the stack and arm the stack overflow guard */
+  Startup_InitStack();
+
+  /* Start the core 1 early to share the RAM initialization */
+  Startup_StartCore1();
+  BootProfile_Mark(BOOT_PROFILE_START_CORE1);
 
   /* Initialize the RAM memory */
   Startup_InitRam();
+  BootProfile_Mark(BOOT_PROFILE_INIT_RAM);
 
   /* Initialize the non-local C++ objects */
   Startup_InitCtors();
+  BootProfile_Mark(BOOT_PROFILE_INIT_CTORS);
 
   /* Start the application */
   Startup_RunApplication();
 }
 
 
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_Init_c1 function (core 1 entry point, called from boot.s)
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void Startup_Init_c1(void)
+{
+  /* Verify the vector table installed by boot.s */
+  Startup_CheckCore1Vectors();
+
+  /* Paint the core 1 stack and arm its stack overflow guard */
+  Startup_InitStack();
+
+  /* Initialize the core 1 share of the RAM memory */
+  Startup_InitRamShare(STARTUP_CORE1, Startup_RamShareCount);
+
+  /* Signal the end of the RAM initialization to core 0 */
+  Startup_Core1RamInitDone = 1ul;
+
+  /* Initialize the core 1 local RAM memory */
+  Startup_InitCore1Ram();
+
+  /* Barrier: the shared RAM must be initialized before running any core 1 code */
+  while(Startup_Core0RamInitDone == 0ul);
+
+  /* Core 1 hook and constructors (run in parallel with the constructors of core 0) */
+  if((unsigned int) Startup_InitCore1 != 0)
+  {
+    Startup_InitCore1();
+  }
+
+  Startup_InitCore1Ctors();
+
+  /* Wait until the application on core 0 releases core 1 */
+  while(Startup_Core1Released == 0ul);
+
+  /* Start the application on core 1 */
+  if((unsigned int) main_c1 != 0)
+  {
+    main_c1();
+  }
+
+  Startup_Unexpected_Exit();
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_ReleaseCore1 function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void Startup_ReleaseCore1(void)
+{
+  Startup_Core1Released = 1ul;
+
+  BootProfile_Mark(BOOT_PROFILE_CORE1_RELEASE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_LoadOverlay function
+///
+/// \descr  Copies the overlay into the IRAM overlay window (shared by all the overlays).
+///         The overlay code (OVERLAY_ATTR) must only be called after a successful load
+///         and as long as no other overlay has been loaded, the caller is in charge of
+///         the serialization between the cores.
+///
+/// \param  OverlayId : overlay number (0..3)
+///
+/// \return TRUE if the overlay is loaded, FALSE for an invalid overlay number
+//-----------------------------------------------------------------------------------------
+boolean Startup_LoadOverlay(unsigned long OverlayId)
+{
+  if(OverlayId >= STARTUP_OVERLAY_NUM)
+  {
+    return(FALSE);
+  }
+
+  if(Startup_LoadedOverlay != OverlayId)
+  {
+    Startup_CopyRegion((__STARTUP_OVERLAY_TABLE)[OverlayId].sourceAddr,
+                       (__STARTUP_OVERLAY_TABLE)[OverlayId].targetAddr,
+                       (__STARTUP_OVERLAY_TABLE)[OverlayId].size);
+
+    /* make sure no stale instruction is fetched from the window */
+    __asm__ volatile ("isync" ::: "memory");
+
+    Startup_LoadedOverlay = OverlayId;
+  }
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_StartCore1 function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_StartCore1(void)
+{
+  /* Check the weak function */
+  if((unsigned int) Mcu_StartCore1 != 0)
+  {
+    /* Both cores share the RAM initialization */
+    Startup_RamShareCount = 2ul;
+
+    Mcu_StartCore1();
+  }
+}
+
 //-----------------------------------------------------------------------------------------
 /// \brief  Startup_InitRam function
 ///
@@ -97,37 +291,177 @@ void Startup_Init(void)
 //-----------------------------------------------------------------------------------------
 static void Startup_InitRam(void)
 {
-  unsigned long ClearTableIdx = 0;
-  //unsigned long CopyTableIdx  = 0;
+  unsigned long CcountStart;
+  unsigned long CcountEnd;
 
-  /* Clear Table */
+  STARTUP_READ_CCOUNT(CcountStart);
+
+  /* Initialize the core 0 share of the RAM memory */
+  Startup_InitRamShare(STARTUP_CORE0, Startup_RamShareCount);
+
+  /* Signal the end of the RAM initialization to core 1 */
+  Startup_Core0RamInitDone = 1ul;
 
-  while((__STARTUP_RUNTIME_CLEARTABLE)[ClearTableIdx].Addr != (unsigned long)-1 && (__STARTUP_RUNTIME_CLEARTABLE)[ClearTableIdx].size != (unsigned long)-1)
+  /* Barrier: wait for core 1 to finish its share before running the constructors */
+  if(Startup_RamShareCount > 1ul)
   {
-    for(unsigned int cpt = 0; cpt < (__STARTUP_RUNTIME_CLEARTABLE)[ClearTableIdx].size; cpt++)
-    {
-      *(volatile unsigned char*)((unsigned long)((__STARTUP_RUNTIME_CLEARTABLE)[ClearTableIdx].Addr) + cpt) = 0;
-    }
+    while(Startup_Core1RamInitDone == 0ul);
+  }
 
-    ClearTableIdx++;
+  /* note: the measurement is stored after the clear, otherwise it would be wiped out with the .bss */
+  STARTUP_READ_CCOUNT(CcountEnd);
+  Startup_RamInitCycles = CcountEnd - CcountStart;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_InitRamShare function
+///
+/// \param  Share      : index of the share processed by the calling core
+///         ShareCount : number of cores sharing the RAM initialization
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_InitRamShare(unsigned long Share, unsigned long ShareCount)
+{
+  unsigned long CopyTableIdx  = 0;
+
+  /* Clear Table */
+  Startup_ClearTableShare(__STARTUP_RUNTIME_CLEARTABLE, Share, ShareCount);
+
+  /* Cold Clear Table (the preserved regions keep their content across a warm reset) */
+  if(Startup_WarmReset == 0ul)
+  {
+    Startup_ClearTableShare(__STARTUP_COLD_CLEARTABLE, Share, ShareCount);
   }
 
-  /* Copy Table (ESP32-S3 does not need to intialize it as we get copied to SRAM by the bootROM) */
-#if 0
-  while((__STARTUP_RUNTIME_COPYTABLE)[CopyTableIdx].sourceAddr != (unsigned long)-1 &&
+  /* Copy Table (the bootROM loads the SRAM sections, the table stages the RTC fast/slow memories, split like the clear table)
+     note: the RTC memories are retained in deep sleep, they are not staged again on a deep-sleep wakeup */
+
+  while((Startup_DeepSleepWake == 0ul) &&
+        (__STARTUP_RUNTIME_COPYTABLE)[CopyTableIdx].sourceAddr != (unsigned long)-1 &&
         (__STARTUP_RUNTIME_COPYTABLE)[CopyTableIdx].targetAddr != (unsigned long)-1 &&
         (__STARTUP_RUNTIME_COPYTABLE)[CopyTableIdx].size       != (unsigned long)-1
        )
   {
-    for(unsigned int cpt = 0; cpt < (__STARTUP_RUNTIME_COPYTABLE)[CopyTableIdx].size; cpt++)
-    {
-      *(volatile unsigned char*)((unsigned long)((__STARTUP_RUNTIME_COPYTABLE)[CopyTableIdx].targetAddr) + cpt) = 
-               *(volatile unsigned char*)((unsigned long)((__STARTUP_RUNTIME_COPYTABLE)[CopyTableIdx].sourceAddr) + cpt);
-    }
+    const unsigned long Size  = (__STARTUP_RUNTIME_COPYTABLE)[CopyTableIdx].size;
+    const unsigned long Chunk = (Size / ShareCount) & ~(STARTUP_RAM_SHARE_ALIGN - 1ul);
+    const unsigned long Start = Share * Chunk;
+
+    Startup_CopyRegion((__STARTUP_RUNTIME_COPYTABLE)[CopyTableIdx].sourceAddr + Start,
+                       (__STARTUP_RUNTIME_COPYTABLE)[CopyTableIdx].targetAddr + Start,
+                       (Share == (ShareCount - 1ul)) ? (Size - Start) : Chunk);
 
     CopyTableIdx++;
   }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_ClearTableShare function
+///
+/// \param  ClearTable : clear table terminated with -1
+///         Share      : index of the share processed by the calling core
+///         ShareCount : number of cores sharing the RAM initialization
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_ClearTableShare(const runtimeClearTable_t* ClearTable, unsigned long Share, unsigned long ShareCount)
+{
+  unsigned long ClearTableIdx = 0;
+
+  /* each region is split into aligned chunks, the last share takes the remainder */
+  while(ClearTable[ClearTableIdx].Addr != (unsigned long)-1 && ClearTable[ClearTableIdx].size != (unsigned long)-1)
+  {
+    const unsigned long Size  = ClearTable[ClearTableIdx].size;
+    const unsigned long Chunk = (Size / ShareCount) & ~(STARTUP_RAM_SHARE_ALIGN - 1ul);
+    const unsigned long Start = Share * Chunk;
+
+    Startup_ClearRegion(ClearTable[ClearTableIdx].Addr + Start,
+                        (Share == (ShareCount - 1ul)) ? (Size - Start) : Chunk);
+
+    ClearTableIdx++;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_ClearRegion function
+///
+/// \param  Addr : start address of the region
+///         Size : length of the region in bytes
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_ClearRegion(unsigned long Addr, unsigned long Size)
+{
+  const unsigned long End = Addr + Size;
+  unsigned long Blocks;
+
+  /* clear the unaligned head byte by byte */
+  while(((Addr & 3ul) != 0ul) && (Addr < End))
+  {
+    *(volatile unsigned char*)Addr = 0;
+    Addr++;
+  }
+
+  /* clear 16-byte blocks with four aligned 32-bit stores per iteration */
+  Blocks = (End - Addr) >> 4;
+
+#if XCHAL_HAVE_LOOPS
+  /* zero-overhead loop (note: the routine is kept out-of-line so the compiler never nests it into one of its own hardware loops) */
+  __asm__ volatile ("loopnez %1, 1f       \n\t"
+                    "s32i    %2, %0, 0    \n\t"
+                    "s32i    %2, %0, 4    \n\t"
+                    "s32i    %2, %0, 8    \n\t"
+                    "s32i    %2, %0, 12   \n\t"
+                    "addi    %0, %0, 16   \n\t"
+                    "1:                   \n\t"
+                    : "+r"(Addr)
+                    : "r"(Blocks), "r"(0ul)
+                    : "memory");
+#else
+  while(Blocks != 0ul)
+  {
+    ((volatile unsigned long*)Addr)[0] = 0;
+    ((volatile unsigned long*)Addr)[1] = 0;
+    ((volatile unsigned long*)Addr)[2] = 0;
+    ((volatile unsigned long*)Addr)[3] = 0;
+    Addr += 16ul;
+    Blocks--;
+  }
 #endif
+
+  /* clear the remaining words */
+  while((End - Addr) >= 4ul)
+  {
+    *(volatile unsigned long*)Addr = 0;
+    Addr += 4ul;
+  }
+
+  /* clear the unaligned tail byte by byte */
+  while(Addr < End)
+  {
+    *(volatile unsigned char*)Addr = 0;
+    Addr++;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_CopyRegion function
+///
+/// \param  Source : start address of the load image (word-aligned)
+///         Target : start address of the run region (word-aligned)
+///         Size   : length of the region in bytes (multiple of 4, see the linker script)
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_CopyRegion(unsigned long Source, unsigned long Target, unsigned long Size)
+{
+  /* note: word accesses only, the IRAM and the RTC fast memory do not support byte stores on the ibus */
+  const unsigned long Words = Size >> 2;
+
+  for(unsigned long word = 0; word < Words; word++)
+  {
+    ((volatile unsigned long*)Target)[word] = ((volatile const unsigned long*)Source)[word];
+  }
 }
 
 //-----------------------------------------------------------------------------------------
@@ -138,15 +472,85 @@ static void Startup_InitRam(void)
 /// \return void
 //-----------------------------------------------------------------------------------------
 static void Startup_InitCtors(void)
+{
+  Startup_RunCtorList(__STARTUP_RUNTIME_CTORS);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_RunCtorList function
+///
+/// \param  CtorList : constructor list terminated with -1
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_RunCtorList(const unsigned long* CtorList)
 {
   unsigned long CtorIdx = 0U;
   
-  while((__STARTUP_RUNTIME_CTORS)[CtorIdx] != ((unsigned long)-1))
+  while(CtorList[CtorIdx] != ((unsigned long)-1))
+  {
+    ((void (*)(void))(CtorList[CtorIdx++]))();
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_CheckCore1Vectors function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_CheckCore1Vectors(void)
+{
+  unsigned long VecBase;
+
+  STARTUP_READ_VECBASE(VecBase);
+
+  if(VecBase != (unsigned long)&_vector_table)
+  {
+    /* the core 1 vectors are not ours (e.g. left by the bootROM), install them again */
+    STARTUP_WRITE_VECBASE((unsigned long)&_vector_table);
+    STARTUP_READ_VECBASE(VecBase);
+
+    if(VecBase != (unsigned long)&_vector_table)
+    {
+      Startup_Unexpected_Exit();
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_InitCore1Ram function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_InitCore1Ram(void)
+{
+  unsigned long ClearTableIdx = 0;
+
+  /* note: the core 1 local .data is loaded by the bootROM, only the local .bss has to be cleared */
+  while((__STARTUP_CORE1_CLEARTABLE)[ClearTableIdx].Addr != (unsigned long)-1 && (__STARTUP_CORE1_CLEARTABLE)[ClearTableIdx].size != (unsigned long)-1)
   {
-    ((void (*)(void))((__STARTUP_RUNTIME_CTORS)[CtorIdx++]))();
+    Startup_ClearRegion((__STARTUP_CORE1_CLEARTABLE)[ClearTableIdx].Addr, (__STARTUP_CORE1_CLEARTABLE)[ClearTableIdx].size);
+
+    ClearTableIdx++;
   }
 }
 
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_InitCore1Ctors function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_InitCore1Ctors(void)
+{
+  Startup_RunCtorList(__STARTUP_CORE1_CTORS);
+}
+
 //-----------------------------------------------------------------------------------------
 /// \brief  Startup_RunApplication function
 ///
@@ -159,6 +563,8 @@ static void Startup_RunApplication(void)
   /* Check the weak function */
   if((unsigned int) main != 0)
   {
+    BootProfile_Mark(BOOT_PROFILE_MAIN);
+
     /* Call the main function */
     (void)main();
   }
@@ -201,4 +607,57 @@ static void Startup_InitSystemClock(void)
 void Startup_InitCore(void)
 {
   Mcu_InitCore();
+
+  /* Check the weak function (the warm reset path is taken only on a validated software reset) */
+  if(((unsigned int) Mcu_IsWarmReset != 0) && (Mcu_IsWarmReset() == TRUE))
+  {
+    Startup_WarmReset = 1ul;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_InitFlashCache function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_InitFlashCache(void)
+{
+  /* Check the weak function (only linked in XIP mode) */
+  if((unsigned int) Cache_InitFlashXip != 0)
+  {
+    Cache_InitFlashXip();
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_RunWakeHook function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_RunWakeHook(void)
+{
+  /* Check the weak function */
+  if(((unsigned int) DeepSleep_RunWakeHook != 0) && (DeepSleep_RunWakeHook() == TRUE))
+  {
+    Startup_DeepSleepWake = 1ul;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Startup_InitStack function
+///
+/// \descr  Runs on each core with its own stack (the interrupts are still disabled).
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void Startup_InitStack(void)
+{
+  Stack_Paint();
+  Stack_EnableGuard();
 }
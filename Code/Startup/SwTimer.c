@@ -0,0 +1,433 @@
+/******************************************************************************************
+  Filename    : SwTimer.c
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Tickless software timers: a binary min-heap of absolute deadlines served
+                by one CPU timer (CCOMPARE0) reprogrammed to the earliest deadline
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "SwTimer.h"
+#include "Irq.h"
+#include "Timebase.h"
+#include "core-isa.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define SWTIMER_CPU_INT           XCHAL_TIMER0_INTERRUPT
+#define SWTIMER_LEVEL             XCHAL_INT6_LEVEL
+
+#define SWTIMER_NO_CORE           0xFFFFFFFFul
+
+/* the comparator is never programmed closer than this to CCOUNT (a missed match waits for a full wrap) */
+#define SWTIMER_MIN_DELAY         256ul
+
+/* longest sleep of the comparator, keeps the CCOUNT wrap extension of Timebase_GetCycles alive */
+#define SWTIMER_MAX_SLEEP         0x40000000ul
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define SWTIMER_WRITE_CCOMPARE0(x)  __asm__ volatile ("wsr.ccompare0 %0\n\tesync" : : "r"(x) : "memory")
+#define SWTIMER_LOCK(ps)            __asm__ volatile ("rsil %0, 15" : "=r"(ps) : : "memory")
+#define SWTIMER_UNLOCK(ps)          __asm__ volatile ("wsr.ps %0\n\trsync" : : "r"(ps) : "memory")
+
+//=============================================================================
+// Externs
+//=============================================================================
+extern uint32 get_core_id(void);
+
+//=============================================================================
+// Globals
+//=============================================================================
+
+/* note: the service runs on the core that called SwTimer_Init, the timers are started and stopped on that core only */
+static uint32 SwTimer_Core = SWTIMER_NO_CORE;
+
+static SwTimer_Type* SwTimer_Heap[SWTIMER_MAX_TIMERS];
+static uint32 SwTimer_Count;
+
+//=============================================================================
+// Static functions
+//=============================================================================
+static void SwTimer_Isr(void* Arg);
+static void SwTimer_Program(void);
+static void SwTimer_HeapInsert(SwTimer_Type* pTimer);
+static void SwTimer_HeapRemove(uint32 Index);
+static void SwTimer_HeapPlace(uint32 Index, SwTimer_Type* pTimer);
+static void SwTimer_SiftUp(uint32 Index);
+static void SwTimer_SiftDown(uint32 Index);
+
+//-----------------------------------------------------------------------------------------
+/// \brief  SwTimer_Init function
+///
+/// \descr  Takes the CPU timer 0 (CCOMPARE0, CPU interrupt 6, level 1) of the calling
+///         core for the timer service.
+///
+/// \param  void
+///
+/// \return TRUE if the service is started
+//-----------------------------------------------------------------------------------------
+boolean SwTimer_Init(void)
+{
+  const uint32 Core = get_core_id();
+  uint32 Ps;
+
+  if((SwTimer_Core != SWTIMER_NO_CORE) || (Irq_Register(Core, SWTIMER_CPU_INT, SWTIMER_LEVEL, SwTimer_Isr, NULL) == FALSE))
+  {
+    return(FALSE);
+  }
+
+  SwTimer_Core = Core;
+
+  SWTIMER_LOCK(Ps);
+  SwTimer_Program();
+  SWTIMER_UNLOCK(Ps);
+
+  Irq_Enable(SWTIMER_CPU_INT);
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  SwTimer_Setup function
+///
+/// \param  pTimer   : timer object
+///         Callback : called from the level 1 interrupt at each expiry
+///         Arg      : callback argument
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+void SwTimer_Setup(SwTimer_Type* pTimer, SwTimer_CallbackType Callback, void* Arg)
+{
+  pTimer->Deadline  = 0ull;
+  pTimer->Period    = 0ul;
+  pTimer->HeapIndex = SWTIMER_NOT_QUEUED;
+  pTimer->Callback  = Callback;
+  pTimer->Arg       = Arg;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  SwTimer_Start function
+///
+/// \param  pTimer : timer object (restarted if already running)
+///         Delay  : first expiry in CPU cycles from now
+///         Period : period in CPU cycles (0: one-shot)
+///
+/// \return TRUE if the timer is started
+//-----------------------------------------------------------------------------------------
+boolean SwTimer_Start(SwTimer_Type* pTimer, uint32 Delay, uint32 Period)
+{
+  return(SwTimer_StartAt(pTimer, Timebase_GetCycles() + Delay, Period));
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  SwTimer_StartAt function
+///
+/// \descr  The next deadlines of a periodic timer are Deadline + n * Period, so the
+///         interrupt latency and the callback duration do not accumulate. Missed
+///         periods are skipped.
+///
+/// \param  pTimer   : timer object (restarted if already running)
+///         Deadline : first expiry in CPU cycles (Timebase_GetCycles)
+///         Period   : period in CPU cycles (0: one-shot)
+///
+/// \return TRUE if the timer is started
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR boolean SwTimer_StartAt(SwTimer_Type* pTimer, uint64 Deadline, uint32 Period)
+{
+  uint32 Ps;
+
+  if((pTimer == NULL) || (pTimer->Callback == NULL) || (get_core_id() != SwTimer_Core))
+  {
+    return(FALSE);
+  }
+
+  SWTIMER_LOCK(Ps);
+
+  if(pTimer->HeapIndex != SWTIMER_NOT_QUEUED)
+  {
+    SwTimer_HeapRemove(pTimer->HeapIndex);
+  }
+
+  if(SwTimer_Count >= SWTIMER_MAX_TIMERS)
+  {
+    SWTIMER_UNLOCK(Ps);
+    return(FALSE);
+  }
+
+  pTimer->Deadline = Deadline;
+  pTimer->Period   = Period;
+
+  SwTimer_HeapInsert(pTimer);
+  SwTimer_Program();
+
+  SWTIMER_UNLOCK(Ps);
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  SwTimer_Stop function
+///
+/// \param  pTimer : timer object
+///
+/// \return TRUE if the timer was running
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR boolean SwTimer_Stop(SwTimer_Type* pTimer)
+{
+  uint32 Ps;
+  boolean Stopped = FALSE;
+
+  if((pTimer == NULL) || (get_core_id() != SwTimer_Core))
+  {
+    return(FALSE);
+  }
+
+  SWTIMER_LOCK(Ps);
+
+  if(pTimer->HeapIndex != SWTIMER_NOT_QUEUED)
+  {
+    SwTimer_HeapRemove(pTimer->HeapIndex);
+    SwTimer_Program();
+    Stopped = TRUE;
+  }
+
+  SWTIMER_UNLOCK(Ps);
+
+  return(Stopped);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  SwTimer_IsActive function
+///
+/// \param  pTimer : timer object
+///
+/// \return TRUE if the timer is queued
+//-----------------------------------------------------------------------------------------
+boolean SwTimer_IsActive(const SwTimer_Type* pTimer)
+{
+  return(((pTimer != NULL) && (pTimer->HeapIndex != SWTIMER_NOT_QUEUED)) ? TRUE : FALSE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  SwTimer_GetCount function
+///
+/// \param  void
+///
+/// \return number of running timers
+//-----------------------------------------------------------------------------------------
+uint32 SwTimer_GetCount(void)
+{
+  return(SwTimer_Count);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  SwTimer_Isr function
+///
+/// \descr  Runs the callbacks of the expired timers, earliest deadline first. The
+///         callbacks run with the heap unlocked and may start or stop any timer.
+///
+/// \param  Arg : not used
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void SwTimer_Isr(void* Arg)
+{
+  uint64 Now;
+  uint32 Ps;
+
+  (void)Arg;
+
+  SWTIMER_LOCK(Ps);
+
+  Now = Timebase_GetCycles();
+
+  while((SwTimer_Count != 0ul) && (SwTimer_Heap[0]->Deadline <= Now))
+  {
+    SwTimer_Type* const pTimer = SwTimer_Heap[0];
+
+    SwTimer_HeapRemove(0ul);
+
+    if(pTimer->Period != 0ul)
+    {
+      pTimer->Deadline += pTimer->Period;
+
+      if(pTimer->Deadline <= Now)
+      {
+        pTimer->Deadline += (((Now - pTimer->Deadline) / pTimer->Period) + 1ull) * pTimer->Period;
+      }
+
+      SwTimer_HeapInsert(pTimer);
+    }
+
+    SWTIMER_UNLOCK(Ps);
+
+    pTimer->Callback(pTimer->Arg);
+
+    SWTIMER_LOCK(Ps);
+
+    Now = Timebase_GetCycles();
+  }
+
+  /* also clears the interrupt */
+  SwTimer_Program();
+
+  SWTIMER_UNLOCK(Ps);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  SwTimer_Program function
+///
+/// \descr  Sets CCOMPARE0 to the earliest deadline, within [now + SWTIMER_MIN_DELAY,
+///         now + SWTIMER_MAX_SLEEP]. Called with the heap locked.
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void SwTimer_Program(void)
+{
+  const uint64 Now = Timebase_GetCycles();
+  uint64 Next      = Now + SWTIMER_MAX_SLEEP;
+
+  if((SwTimer_Count != 0ul) && (SwTimer_Heap[0]->Deadline < Next))
+  {
+    Next = SwTimer_Heap[0]->Deadline;
+  }
+
+  if(Next < (Now + SWTIMER_MIN_DELAY))
+  {
+    Next = Now + SWTIMER_MIN_DELAY;
+  }
+
+  SWTIMER_WRITE_CCOMPARE0((uint32)Next);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  SwTimer_HeapInsert function
+///
+/// \param  pTimer : timer to queue (the heap is not full)
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void SwTimer_HeapInsert(SwTimer_Type* pTimer)
+{
+  SwTimer_HeapPlace(SwTimer_Count, pTimer);
+  SwTimer_Count++;
+  SwTimer_SiftUp(pTimer->HeapIndex);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  SwTimer_HeapRemove function
+///
+/// \param  Index : heap position of the timer to remove
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void SwTimer_HeapRemove(uint32 Index)
+{
+  SwTimer_Type* const pLast = SwTimer_Heap[SwTimer_Count - 1ul];
+
+  SwTimer_Heap[Index]->HeapIndex = SWTIMER_NOT_QUEUED;
+  SwTimer_Count--;
+
+  if(Index != SwTimer_Count)
+  {
+    /* the last timer fills the hole and moves up or down to its place */
+    SwTimer_HeapPlace(Index, pLast);
+    SwTimer_SiftUp(Index);
+    SwTimer_SiftDown(pLast->HeapIndex);
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  SwTimer_HeapPlace function
+///
+/// \param  Index  : heap position
+///         pTimer : timer stored at the position
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void SwTimer_HeapPlace(uint32 Index, SwTimer_Type* pTimer)
+{
+  SwTimer_Heap[Index] = pTimer;
+  pTimer->HeapIndex   = Index;
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  SwTimer_SiftUp function
+///
+/// \param  Index : heap position of a timer that may be earlier than its parent
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void SwTimer_SiftUp(uint32 Index)
+{
+  SwTimer_Type* const pTimer = SwTimer_Heap[Index];
+
+  while(Index != 0ul)
+  {
+    const uint32 Parent = (Index - 1ul) / 2ul;
+
+    if(SwTimer_Heap[Parent]->Deadline <= pTimer->Deadline)
+    {
+      break;
+    }
+
+    SwTimer_HeapPlace(Index, SwTimer_Heap[Parent]);
+    Index = Parent;
+  }
+
+  SwTimer_HeapPlace(Index, pTimer);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  SwTimer_SiftDown function
+///
+/// \param  Index : heap position of a timer that may be later than its children
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static IRAM_ATTR void SwTimer_SiftDown(uint32 Index)
+{
+  SwTimer_Type* const pTimer = SwTimer_Heap[Index];
+
+  for(;;)
+  {
+    uint32 Child = (2ul * Index) + 1ul;
+
+    if(Child >= SwTimer_Count)
+    {
+      break;
+    }
+
+    if(((Child + 1ul) < SwTimer_Count) && (SwTimer_Heap[Child + 1ul]->Deadline < SwTimer_Heap[Child]->Deadline))
+    {
+      Child++;
+    }
+
+    if(pTimer->Deadline <= SwTimer_Heap[Child]->Deadline)
+    {
+      break;
+    }
+
+    SwTimer_HeapPlace(Index, SwTimer_Heap[Child]);
+    Index = Child;
+  }
+
+  SwTimer_HeapPlace(Index, pTimer);
+}
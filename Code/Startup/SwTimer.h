@@ -0,0 +1,64 @@
+/******************************************************************************************
+  Filename    : SwTimer.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Tickless software timers on one CPU timer (CCOMPARE0) header file
+
+******************************************************************************************/
+
+#ifndef __SWTIMER_H__
+#define __SWTIMER_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+
+/* capacity of the timer heap (4 bytes per entry) */
+#ifndef SWTIMER_MAX_TIMERS
+  #define SWTIMER_MAX_TIMERS      1024ul
+#endif
+
+/* HeapIndex of a stopped timer */
+#define SWTIMER_NOT_QUEUED        0xFFFFFFFFul
+
+//=============================================================================
+// Types
+//=============================================================================
+typedef void (*SwTimer_CallbackType)(void* Arg);
+
+/* timer object owned by the user (must stay valid while the timer runs) */
+typedef struct
+{
+  uint64               Deadline;    /* next expiry in CPU cycles (Timebase_GetCycles) */
+  uint32               Period;      /* period in CPU cycles, 0: one-shot */
+  uint32               HeapIndex;
+  SwTimer_CallbackType Callback;
+  void*                Arg;
+}SwTimer_Type;
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+boolean SwTimer_Init(void);
+void SwTimer_Setup(SwTimer_Type* pTimer, SwTimer_CallbackType Callback, void* Arg);
+boolean SwTimer_Start(SwTimer_Type* pTimer, uint32 Delay, uint32 Period);
+boolean SwTimer_StartAt(SwTimer_Type* pTimer, uint64 Deadline, uint32 Period);
+boolean SwTimer_Stop(SwTimer_Type* pTimer);
+boolean SwTimer_IsActive(const SwTimer_Type* pTimer);
+uint32 SwTimer_GetCount(void);
+
+#endif
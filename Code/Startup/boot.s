@@ -28,7 +28,7 @@
 .extern __CORE0_STACK_TOP
 .extern __CORE1_STACK_TOP
 .extern Startup_Init
-.extern main_c1
+.extern Startup_Init_c1
 .globl _start
 
 .equ  core0_id, 0xcdcd
@@ -39,6 +39,15 @@ _start:
         movi a8, 0
         wsr a8, interrupt
         wsr a8, intenable
+
+        /* no fast handler installed on the level 4 and level 5 vectors */
+        wsr a8, misc0
+        wsr a8, misc1
+
+        /* no interrupt frame active, FPU disabled until its first use (lazy FPU context) */
+        wsr a8, misc2
+        wsr a8, cpenable
+
         movi a8, -1
         wsr a8, intclear
         wsr a8, ccompare0
@@ -66,8 +75,8 @@ _start:
         /* setup the stack pointer for core1 */
         movi a1, __CORE1_STACK_TOP
 
-        /* jump to core1 main function */
-        j  main_c1
+        /* setup the core1 runtime environment and jump to core1 main function */
+        j  Startup_Init_c1
         j .
 
 .size _start, .-_start
@@ -79,7 +88,7 @@ _start:
   
   \return 
 ********************************************************************************************/
-.section .text
+.section .iram.hot,"ax"
 .type get_core_id, @function
 .align 4
 .globl get_core_id
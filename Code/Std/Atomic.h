@@ -0,0 +1,148 @@
+/******************************************************************************************
+  Filename    : Atomic.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Atomic operations (S32C1I) and memory barriers shared by both cores
+
+******************************************************************************************/
+
+#ifndef __ATOMIC_H__
+#define __ATOMIC_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+#include "core-isa.h"
+
+#if (XCHAL_HAVE_S32C1I == 0) || (XCHAL_HAVE_RELEASE_SYNC == 0)
+  #error "Atomic.h needs the S32C1I, L32AI and S32RI instructions"
+#endif
+
+//=============================================================================
+// Macros
+//=============================================================================
+
+/* the compiler keeps the memory accesses on their side, the CPU may still reorder them */
+#define ATOMIC_COMPILER_BARRIER()   __asm__ volatile ("" : : : "memory")
+
+/* full barrier: every load and store before it completes before any load or store after it */
+#define ATOMIC_BARRIER()            __asm__ volatile ("memw" : : : "memory")
+
+#define ATOMIC_INLINE               static inline __attribute__((always_inline))
+
+//=============================================================================
+// Functions
+//=============================================================================
+
+/* note: S32C1I is only atomic on the internal SRAM (.data, .bss, the stacks),
+         not on the external PSRAM or on the peripheral registers */
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Atomic_LoadAcquire function
+///
+/// \param  pValue : shared word
+///
+/// \return its value, the accesses after the load are not moved before it (L32AI)
+//-----------------------------------------------------------------------------------------
+ATOMIC_INLINE uint32 Atomic_LoadAcquire(const volatile uint32* pValue)
+{
+  uint32 Value;
+
+  __asm__ volatile ("l32ai %0, %1, 0" : "=r"(Value) : "r"(pValue) : "memory");
+
+  return(Value);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Atomic_StoreRelease function
+///
+/// \descr  The accesses before the store complete before it (S32RI).
+///
+/// \param  pValue : shared word
+///         Value  : value to store
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+ATOMIC_INLINE void Atomic_StoreRelease(volatile uint32* pValue, uint32 Value)
+{
+  __asm__ volatile ("s32ri %0, %1, 0" : : "r"(Value), "r"(pValue) : "memory");
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Atomic_CompareExchange function
+///
+/// \descr  Stores Desired if the word holds Expected, in one bus transaction (S32C1I).
+///         The previous accesses complete first (full barrier on both sides).
+///
+/// \param  pValue   : shared word
+///         Expected : value compared with the word
+///         Desired  : new value
+///
+/// \return value of the word before the operation (== Expected on success)
+//-----------------------------------------------------------------------------------------
+ATOMIC_INLINE uint32 Atomic_CompareExchange(volatile uint32* pValue, uint32 Expected, uint32 Desired)
+{
+  __asm__ volatile ("memw\n\t"
+                    "wsr.scompare1 %2\n\t"
+                    "s32c1i %0, %1, 0\n\t"
+                    "memw"
+                    : "+r"(Desired)
+                    : "r"(pValue), "r"(Expected)
+                    : "memory");
+
+  return(Desired);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Atomic_FetchAdd function
+///
+/// \param  pValue : shared word
+///         Add    : value added (wraps modulo 2^32, use (uint32)-n to subtract)
+///
+/// \return value of the word before the addition
+//-----------------------------------------------------------------------------------------
+ATOMIC_INLINE uint32 Atomic_FetchAdd(volatile uint32* pValue, uint32 Add)
+{
+  uint32 Old = *pValue;
+  uint32 Seen;
+
+  while((Seen = Atomic_CompareExchange(pValue, Old, Old + Add)) != Old)
+  {
+    Old = Seen;
+  }
+
+  return(Old);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Atomic_Exchange function
+///
+/// \param  pValue : shared word
+///         Value  : new value
+///
+/// \return value of the word before the exchange
+//-----------------------------------------------------------------------------------------
+ATOMIC_INLINE uint32 Atomic_Exchange(volatile uint32* pValue, uint32 Value)
+{
+  uint32 Old = *pValue;
+  uint32 Seen;
+
+  while((Seen = Atomic_CompareExchange(pValue, Old, Value)) != Old)
+  {
+    Old = Seen;
+  }
+
+  return(Old);
+}
+
+#endif
@@ -49,6 +49,77 @@ typedef signed long long sint64;
   #define NULL_PTR    (void*)0
 #endif
 
+/* section attributes for a predictable code and data placement (see Memory_Map.ld and Memory_Map_Xip.ld)
+     IRAM_ATTR : hot code kept in the internal instruction RAM (interrupt path, code running before the flash cache is mapped in XIP mode)
+     COLD_ATTR : cold code (init, error paths), executed in place from flash in XIP mode
+     DRAM_ATTR : data accessed from the hot path, always kept in the internal data RAM
+     RTC_FAST_ATTR / RTC_SLOW_ATTR : data staged into the RTC fast/slow memory by the startup copy table
+     RTC_IRAM_ATTR : code staged into the RTC fast memory by the startup copy table
+     RTC_NOINIT_ATTR : data in the RTC fast memory neither loaded nor cleared, kept across the system resets
+     CORE1_DATA_ATTR / CORE1_BSS_ATTR : data local to core 1, the core 1 local .bss is cleared by core 1 itself
+     NOINIT_ATTR : data neither loaded nor cleared by the startup code
+     PRESERVED_ATTR : data cleared on a cold boot only, kept as is across a warm (software) reset
+     OVERLAY_ATTR(n) : code of the overlay n (0..3), loaded on demand into the shared IRAM window by Startup_LoadOverlay()
+   note: the counter suffix gives every object its own input section, this avoids section type conflicts between const and non-const data */
+#define PLATFORM_STRINGIFY(x)        #x
+#define PLATFORM_SECTION(name, id)   __attribute__((section(name "." PLATFORM_STRINGIFY(id))))
+
+#ifndef IRAM_ATTR
+  #define IRAM_ATTR   PLATFORM_SECTION(".iram.hot", __COUNTER__)
+#endif
+
+#ifndef COLD_ATTR
+  #define COLD_ATTR   PLATFORM_SECTION(".text.cold", __COUNTER__)
+#endif
+
+#ifndef DRAM_ATTR
+  #define DRAM_ATTR   PLATFORM_SECTION(".dram.fast", __COUNTER__)
+#endif
+
+#ifndef RTC_FAST_ATTR
+  #define RTC_FAST_ATTR   PLATFORM_SECTION(".rtc.fast.data", __COUNTER__)
+#endif
+
+#ifndef RTC_SLOW_ATTR
+  #define RTC_SLOW_ATTR   PLATFORM_SECTION(".rtc.slow.data", __COUNTER__)
+#endif
+
+#ifndef RTC_IRAM_ATTR
+  #define RTC_IRAM_ATTR   PLATFORM_SECTION(".rtc.fast.text", __COUNTER__)
+#endif
+
+#ifndef RTC_NOINIT_ATTR
+  #define RTC_NOINIT_ATTR   PLATFORM_SECTION(".rtc.noinit", __COUNTER__)
+#endif
+
+#ifndef CORE1_DATA_ATTR
+  #define CORE1_DATA_ATTR   PLATFORM_SECTION(".core1.data", __COUNTER__)
+#endif
+
+#ifndef CORE1_BSS_ATTR
+  #define CORE1_BSS_ATTR    PLATFORM_SECTION(".core1.bss", __COUNTER__)
+#endif
+
+#ifndef NOINIT_ATTR
+  #define NOINIT_ATTR   PLATFORM_SECTION(".noinit", __COUNTER__)
+#endif
+
+#ifndef PRESERVED_ATTR
+  #define PRESERVED_ATTR   PLATFORM_SECTION(".preserved.bss", __COUNTER__)
+#endif
+
+#ifndef OVERLAY_ATTR
+  #define OVERLAY_ATTR(n)   PLATFORM_SECTION(".overlay." PLATFORM_STRINGIFY(n), __COUNTER__)
+#endif
+
+/* registers a core 1 constructor (run by core 1 before main_c1, in parallel with the constructors of core 0) */
+#define PLATFORM_CORE1_INIT_NAME(fn, id)   Core1Init_##fn##_##id
+#define PLATFORM_CORE1_INIT(fn, id)        static const pFunc PLATFORM_CORE1_INIT_NAME(fn, id) __attribute__((used, section(".core1_init_array"))) = (fn)
+
+#ifndef CORE1_INIT
+  #define CORE1_INIT(fn)   PLATFORM_CORE1_INIT(fn, __COUNTER__)
+#endif
+
 #include <stdbool.h>
 #include <stdint.h>
 
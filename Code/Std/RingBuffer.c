@@ -0,0 +1,225 @@
+/******************************************************************************************
+  Filename    : RingBuffer.c
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Lock-free bounded ring buffer (multi or single producer, single consumer).
+                Each slot carries a sequence word: the position it accepts a producer for
+                (free), or that position + 1 (filled). The producers reserve positions with
+                a CAS on the head and publish each slot by its sequence word, so a producer
+                interrupted between the two steps never blocks the other producers.
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "RingBuffer.h"
+#include "Atomic.h"
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define RINGBUFFER_SLOT(pRb, Pos)   (&(pRb)->pSlots[((Pos) & (pRb)->Mask) * ((pRb)->ElemWords + 1ul)])
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RingBuffer_Init function
+///
+/// \param  pRb      : ring buffer (in the internal SRAM)
+///         pStorage : RINGBUFFER_STORAGE_WORDS(ElemSize, Size) words in the internal SRAM
+///         Size     : number of elements (power of two, at least 2)
+///         ElemSize : element size in bytes (multiple of 4)
+///         Mode     : RINGBUFFER_MPSC or RINGBUFFER_SPSC
+///
+/// \return TRUE if the parameters are valid
+//-----------------------------------------------------------------------------------------
+boolean RingBuffer_Init(RingBuffer_Type* pRb, uint32* pStorage, uint32 Size, uint32 ElemSize, RingBuffer_ModeType Mode)
+{
+  uint32 Pos;
+
+  if((pRb == NULL) || (pStorage == NULL) || (Size < 2ul) || ((Size & (Size - 1ul)) != 0ul) ||
+     (ElemSize == 0ul) || ((ElemSize & 3ul) != 0ul))
+  {
+    return(FALSE);
+  }
+
+  pRb->pSlots    = pStorage;
+  pRb->Mask      = Size - 1ul;
+  pRb->ElemWords = ElemSize / 4ul;
+  pRb->Mode      = Mode;
+  pRb->Head      = 0ul;
+  pRb->Tail      = 0ul;
+
+  for(Pos = 0ul; Pos < Size; Pos++)
+  {
+    *RINGBUFFER_SLOT(pRb, Pos) = Pos;
+  }
+
+  ATOMIC_BARRIER();
+
+  return(TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RingBuffer_Put function
+///
+/// \param  pRb   : ring buffer
+///         pElem : element to copy (word aligned)
+///
+/// \return TRUE if queued, FALSE if full
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR boolean RingBuffer_Put(RingBuffer_Type* pRb, const void* pElem)
+{
+  return((RingBuffer_PutBatch(pRb, pElem, 1ul) == 1ul) ? TRUE : FALSE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RingBuffer_PutBatch function
+///
+/// \descr  Reserves Count consecutive positions with one CAS, then copies and publishes
+///         the elements in order. The consumer frees the slots in order, so the batch
+///         fits as soon as its last slot is free. In SPSC mode the head is only stored.
+///
+/// \param  pRb    : ring buffer
+///         pElems : array of Count elements (word aligned)
+///         Count  : number of elements
+///
+/// \return Count if queued, 0 if there is not enough room (nothing is queued)
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR uint32 RingBuffer_PutBatch(RingBuffer_Type* pRb, const void* pElems, uint32 Count)
+{
+  const uint32* pSrc = (const uint32*)pElems;
+  uint32* pSlot;
+  uint32 Pos;
+  uint32 Last;
+  sint32 Diff;
+  uint32 i;
+  uint32 w;
+
+  if((Count == 0ul) || (Count > (pRb->Mask + 1ul)))
+  {
+    return(0ul);
+  }
+
+  for(;;)
+  {
+    /* the other producers move the head with a CAS, read it as a shared word (L32AI) */
+    Pos  = Atomic_LoadAcquire(&pRb->Head);
+    Last = Pos + Count - 1ul;
+    Diff = (sint32)(Atomic_LoadAcquire(RINGBUFFER_SLOT(pRb, Last)) - Last);
+
+    if(Diff < 0)
+    {
+      /* the last slot still holds an element of the previous lap */
+      return(0ul);
+    }
+
+    if(Diff == 0)
+    {
+      if(pRb->Mode == RINGBUFFER_SPSC)
+      {
+        pRb->Head = Pos + Count;
+        break;
+      }
+
+      if(Atomic_CompareExchange(&pRb->Head, Pos, Pos + Count) == Pos)
+      {
+        break;
+      }
+    }
+
+    /* another producer moved the head, retry from the new one */
+  }
+
+  for(i = 0ul; i < Count; i++)
+  {
+    pSlot = RINGBUFFER_SLOT(pRb, Pos + i);
+
+    for(w = 0ul; w < pRb->ElemWords; w++)
+    {
+      pSlot[w + 1ul] = *pSrc++;
+    }
+
+    Atomic_StoreRelease(&pSlot[0], Pos + i + 1ul);
+  }
+
+  return(Count);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RingBuffer_Get function
+///
+/// \param  pRb   : ring buffer
+///         pElem : element copied out (word aligned)
+///
+/// \return TRUE if an element is read, FALSE if empty
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR boolean RingBuffer_Get(RingBuffer_Type* pRb, void* pElem)
+{
+  return((RingBuffer_GetBatch(pRb, pElem, 1ul) == 1ul) ? TRUE : FALSE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RingBuffer_GetBatch function
+///
+/// \descr  Single consumer: copies out the published elements in order, up to MaxCount.
+///         It stops at a slot reserved by a producer but not published yet.
+///
+/// \param  pRb      : ring buffer
+///         pElems   : array of MaxCount elements (word aligned)
+///         MaxCount : room of the array
+///
+/// \return number of elements read
+//-----------------------------------------------------------------------------------------
+IRAM_ATTR uint32 RingBuffer_GetBatch(RingBuffer_Type* pRb, void* pElems, uint32 MaxCount)
+{
+  uint32* pDst = (uint32*)pElems;
+  uint32* pSlot;
+  uint32 Pos = pRb->Tail;
+  uint32 n;
+  uint32 w;
+
+  for(n = 0ul; n < MaxCount; n++)
+  {
+    pSlot = RINGBUFFER_SLOT(pRb, Pos);
+
+    /* compared on 32 bits, the position wraps at 2^32 whatever the width of long */
+    if(Atomic_LoadAcquire(&pSlot[0]) != (uint32)(Pos + 1ul))
+    {
+      break;
+    }
+
+    for(w = 0ul; w < pRb->ElemWords; w++)
+    {
+      *pDst++ = pSlot[w + 1ul];
+    }
+
+    /* free for the producer of the next lap */
+    Atomic_StoreRelease(&pSlot[0], Pos + pRb->Mask + 1ul);
+    Pos++;
+  }
+
+  pRb->Tail = Pos;
+
+  return(n);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RingBuffer_GetCount function
+///
+/// \param  pRb : ring buffer
+///
+/// \return positions reserved and not read yet (a snapshot, published or not)
+//-----------------------------------------------------------------------------------------
+uint32 RingBuffer_GetCount(const RingBuffer_Type* pRb)
+{
+  return(pRb->Head - pRb->Tail);
+}
@@ -0,0 +1,66 @@
+/******************************************************************************************
+  Filename    : RingBuffer.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Lock-free bounded ring buffer (multi or single producer, single consumer)
+                header file
+
+******************************************************************************************/
+
+#ifndef __RING_BUFFER_H__
+#define __RING_BUFFER_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+#include "core-isa.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define RINGBUFFER_ALIGN                      XCHAL_DCACHE_LINESIZE
+
+/* words of storage for Size elements of ElemSize bytes (one sequence word per slot) */
+#define RINGBUFFER_STORAGE_WORDS(ElemSize, Size)  ((Size) * ((((ElemSize) + 3ul) / 4ul) + 1ul))
+
+//=============================================================================
+// Types
+//=============================================================================
+typedef enum
+{
+  RINGBUFFER_MPSC = 0,    /* any context of either core may put */
+  RINGBUFFER_SPSC         /* a single context puts (no CAS on the head) */
+}RingBuffer_ModeType;
+
+/* the producer and the consumer indexes are on separate lines, the storage is given by the user */
+typedef struct
+{
+  uint32*             pSlots;
+  uint32              Mask;
+  uint32              ElemWords;
+  RingBuffer_ModeType Mode;
+  volatile uint32     Head __attribute__((aligned(RINGBUFFER_ALIGN)));   /* next position reserved by a producer */
+  volatile uint32     Tail __attribute__((aligned(RINGBUFFER_ALIGN)));   /* next position read by the consumer */
+}RingBuffer_Type;
+
+//=============================================================================
+// Prototypes
+//=============================================================================
+boolean RingBuffer_Init(RingBuffer_Type* pRb, uint32* pStorage, uint32 Size, uint32 ElemSize, RingBuffer_ModeType Mode);
+boolean RingBuffer_Put(RingBuffer_Type* pRb, const void* pElem);
+uint32 RingBuffer_PutBatch(RingBuffer_Type* pRb, const void* pElems, uint32 Count);
+boolean RingBuffer_Get(RingBuffer_Type* pRb, void* pElem);
+uint32 RingBuffer_GetBatch(RingBuffer_Type* pRb, void* pElems, uint32 MaxCount);
+uint32 RingBuffer_GetCount(const RingBuffer_Type* pRb);
+
+#endif
@@ -0,0 +1,132 @@
+/******************************************************************************************
+  Filename    : Spinlock.h
+
+  Core        : Xtensa LX7
+
+  MCU         : ESP32-S3
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Ticket spinlocks between the two cores
+
+******************************************************************************************/
+
+#ifndef __SPINLOCK_H__
+#define __SPINLOCK_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Atomic.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define SPINLOCK_INIT             { 0ul, 0ul }
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define SPINLOCK_IRQ_SAVE(ps)     __asm__ volatile ("rsil %0, 15" : "=r"(ps) : : "memory")
+#define SPINLOCK_IRQ_RESTORE(ps)  __asm__ volatile ("wsr.ps %0\n\trsync" : : "r"(ps) : "memory")
+
+//=============================================================================
+// Types
+//=============================================================================
+
+/* the cores are served in the order of their tickets (no starvation),
+   the lock must be in the internal SRAM (see Atomic.h) */
+typedef struct
+{
+  volatile uint32 Next;     /* next ticket to hand out */
+  volatile uint32 Owner;    /* ticket holding the lock */
+}Spinlock_Type;
+
+//=============================================================================
+// Functions
+//=============================================================================
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Spinlock_Lock function
+///
+/// \descr  Waits for the lock with the interrupts left as they are. A lock also taken
+///         by an interrupt handler of the same core must use Spinlock_LockIrqSave.
+///
+/// \param  pLock : lock
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+ATOMIC_INLINE void Spinlock_Lock(Spinlock_Type* pLock)
+{
+  const uint32 Ticket = Atomic_FetchAdd(&pLock->Next, 1ul);
+
+  while(Atomic_LoadAcquire(&pLock->Owner) != Ticket);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Spinlock_TryLock function
+///
+/// \param  pLock : lock
+///
+/// \return TRUE if the lock is taken (it was free)
+//-----------------------------------------------------------------------------------------
+ATOMIC_INLINE boolean Spinlock_TryLock(Spinlock_Type* pLock)
+{
+  const uint32 Owner = Atomic_LoadAcquire(&pLock->Owner);
+
+  return((Atomic_CompareExchange(&pLock->Next, Owner, Owner + 1ul) == Owner) ? TRUE : FALSE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Spinlock_Unlock function
+///
+/// \param  pLock : lock held by the calling core
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+ATOMIC_INLINE void Spinlock_Unlock(Spinlock_Type* pLock)
+{
+  /* only the holder writes Owner */
+  Atomic_StoreRelease(&pLock->Owner, pLock->Owner + 1ul);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Spinlock_LockIrqSave function
+///
+/// \descr  Masks the interrupts of the calling core (up to level 6), then takes the lock.
+///
+/// \param  pLock : lock
+///
+/// \return PS to give back to Spinlock_UnlockIrqRestore
+//-----------------------------------------------------------------------------------------
+ATOMIC_INLINE uint32 Spinlock_LockIrqSave(Spinlock_Type* pLock)
+{
+  uint32 Ps;
+
+  SPINLOCK_IRQ_SAVE(Ps);
+
+  Spinlock_Lock(pLock);
+
+  return(Ps);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  Spinlock_UnlockIrqRestore function
+///
+/// \param  pLock : lock held by the calling core
+///         Ps    : value returned by Spinlock_LockIrqSave
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+ATOMIC_INLINE void Spinlock_UnlockIrqRestore(Spinlock_Type* pLock, uint32 Ps)
+{
+  Spinlock_Unlock(pLock);
+
+  SPINLOCK_IRQ_RESTORE(Ps);
+}
+
+#endif
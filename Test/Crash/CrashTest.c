@@ -0,0 +1,203 @@
+/******************************************************************************************
+  Filename    : CrashTest.c
+
+  Core        : host (x86-64, AArch64)
+
+  MCU         : none
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Host test of the crash record (make run). A record sealed as by
+                Crash_Finalize must pass Crash_IsValid, be sent once by
+                Crash_ReportPrevious, and pass the CRC check of CrashDecoder.py (the
+                frame is written to the file given as argument).
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include <stdio.h>
+#include <string.h>
+
+/* the sealing and the validity check are static, the test is built with the module */
+#include "Crash.c"
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define CRASH_TEST_CHECK(Cond)  CrashTest_Check((Cond), #Cond, __LINE__)
+
+//=============================================================================
+// Globals
+//=============================================================================
+RTC_CNTL_Type Host_RtcCntl;
+UART0_Type    Host_Uart0;
+
+static uint32 CrashTest_Failures;
+
+//=============================================================================
+// Static functions
+//=============================================================================
+static void CrashTest_Check(int Cond, const char* pText, int Line);
+static void CrashTest_Fill(Crash_RecordType* pRecord, uint32 Core);
+static boolean CrashTest_WriteFrame(const char* pPath, const Crash_RecordType* pRecord);
+
+//-----------------------------------------------------------------------------------------
+/// \brief  main function
+///
+/// \param  argc : 2
+///         argv : path of the frame file for CrashDecoder.py
+///
+/// \return 0 if every check passed
+//-----------------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  Crash_RecordType* pRecord = &Crash_Record[1];
+  Crash_RecordType Sealed;
+
+  /* random RTC memory after a power-on */
+  memset(Crash_Record, 0x5A, sizeof(Crash_Record));
+
+  CRASH_TEST_CHECK(Crash_IsValid(&Crash_Record[0]) == FALSE);
+  CRASH_TEST_CHECK(Crash_ReportPrevious() == FALSE);
+
+  /* sealed as by Crash_Finalize */
+  CrashTest_Fill(pRecord, 1ul);
+  Crash_Seal(pRecord);
+
+  CRASH_TEST_CHECK(pRecord->Magic == CRASH_MAGIC);
+  CRASH_TEST_CHECK(Crash_IsValid(pRecord) == TRUE);
+
+  Sealed = *pRecord;
+
+  /* any changed byte, a cleared magic or a too long stack snapshot fails */
+  ((uint8*)pRecord)[200] ^= 0x01u;
+  CRASH_TEST_CHECK(Crash_IsValid(pRecord) == FALSE);
+  ((uint8*)pRecord)[200] ^= 0x01u;
+  CRASH_TEST_CHECK(Crash_IsValid(pRecord) == TRUE);
+
+  pRecord->Magic = 0ul;
+  CRASH_TEST_CHECK(Crash_IsValid(pRecord) == FALSE);
+  pRecord->Magic = CRASH_MAGIC;
+
+  pRecord->StackWords = CRASH_STACK_WORDS + 1ul;
+  Crash_Seal(pRecord);
+  CRASH_TEST_CHECK(Crash_IsValid(pRecord) == FALSE);
+
+  /* sent once, then cleared */
+  *pRecord = Sealed;
+
+  CRASH_TEST_CHECK(Crash_ReportPrevious() == TRUE);
+  CRASH_TEST_CHECK(pRecord->Magic == 0ul);
+  CRASH_TEST_CHECK(Host_Uart0.FIFO.reg == ((uint8*)&Sealed)[CRASH_RECORD_SIZE - 1ul]);
+  CRASH_TEST_CHECK(Crash_ReportPrevious() == FALSE);
+
+  if(argc > 1)
+  {
+    CRASH_TEST_CHECK(CrashTest_WriteFrame(argv[1], &Sealed) == TRUE);
+  }
+
+  printf("CRASH %s (%lu failed checks)\n", (CrashTest_Failures == 0ul) ? "OK" : "FAIL",
+                                          (unsigned long)CrashTest_Failures);
+
+  return((CrashTest_Failures == 0ul) ? 0 : 1);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  CrashTest_Check function
+///
+/// \param  Cond  : checked condition
+///         pText : its source text
+///         Line  : its line
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void CrashTest_Check(int Cond, const char* pText, int Line)
+{
+  if(!Cond)
+  {
+    printf("  line %d: %s\n", Line, pText);
+
+    CrashTest_Failures++;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  CrashTest_Fill function
+///
+/// \descr  Fills the record as CrashCapture does for a LoadProhibited exception.
+///
+/// \param  pRecord : crash record
+///         Core    : faulting core
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void CrashTest_Fill(Crash_RecordType* pRecord, uint32 Core)
+{
+  uint32 i;
+
+  pRecord->Core     = Core;
+  pRecord->Reason   = CRASH_REASON_KERNEL_EXCEPTION;
+  pRecord->ExcCause = 28ul;
+  pRecord->ExcVAddr = 0x00000004ul;
+  pRecord->Ps       = 0x00040020ul;
+  pRecord->Sar      = 7ul;
+  pRecord->Lbeg     = 0ul;
+  pRecord->Lend     = 0ul;
+  pRecord->Lcount   = 0ul;
+  pRecord->Depc     = 0ul;
+
+  for(i = 0ul; i < 7ul; i++)
+  {
+    pRecord->Epc[i] = 0x40378000ul + (i * 0x10ul);
+  }
+
+  for(i = 0ul; i < 6ul; i++)
+  {
+    pRecord->Eps[i] = 0x00060020ul + i;
+  }
+
+  for(i = 0ul; i < 16ul; i++)
+  {
+    pRecord->A[i] = 0xA0000000ul + i;
+  }
+
+  pRecord->A[1]       = 0x3FCE0F00ul;
+  pRecord->StackWords = CRASH_STACK_WORDS;
+
+  for(i = 0ul; i < CRASH_STACK_WORDS; i++)
+  {
+    pRecord->Stack[i] = 0x3FCE1000ul + (i * 4ul);
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  CrashTest_WriteFrame function
+///
+/// \param  pPath   : output file
+///         pRecord : record sent as by Crash_ReportPrevious
+///
+/// \return TRUE if written
+//-----------------------------------------------------------------------------------------
+static boolean CrashTest_WriteFrame(const char* pPath, const Crash_RecordType* pRecord)
+{
+  const uint8 Length[2] = { (uint8)(CRASH_RECORD_SIZE & 0xFFul), (uint8)(CRASH_RECORD_SIZE >> 8) };
+  FILE* pFile = fopen(pPath, "wb");
+  boolean Written;
+
+  if(pFile == NULL)
+  {
+    return(FALSE);
+  }
+
+  Written = ((fwrite(CRASH_FRAME_SYNC, 1u, CRASH_FRAME_SYNC_SIZE, pFile) == CRASH_FRAME_SYNC_SIZE) &&
+             (fwrite(Length, 1u, sizeof(Length), pFile) == sizeof(Length)) &&
+             (fwrite(pRecord, 1u, CRASH_RECORD_SIZE, pFile) == CRASH_RECORD_SIZE)) ? TRUE : FALSE;
+
+  return(((fclose(pFile) == 0) && (Written == TRUE)) ? TRUE : FALSE);
+}
@@ -0,0 +1,69 @@
+/******************************************************************************************
+  Filename    : esp32s3.h
+
+  Core        : host (x86-64, AArch64)
+
+  MCU         : none
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : The registers used by Code/Startup/Crash.c, as plain host variables.
+                Force-included before the sources (-include), it takes the include guard
+                of Code/Mcal/esp32s3.h.
+
+******************************************************************************************/
+
+#ifndef ESP32_S3_H
+#define ESP32_S3_H
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+
+//=============================================================================
+// Types
+//=============================================================================
+typedef struct
+{
+  union
+  {
+    struct
+    {
+      uint32 SW_SYS_RST : 1;
+    }bit;
+    uint32 reg;
+  }OPTIONS0;
+}RTC_CNTL_Type;
+
+typedef struct
+{
+  union
+  {
+    uint32 reg;
+  }FIFO;
+
+  union
+  {
+    struct
+    {
+      uint32 TXFIFO_CNT : 10;
+    }bit;
+    uint32 reg;
+  }STATUS;
+}UART0_Type;
+
+//=============================================================================
+// Registers
+//=============================================================================
+extern RTC_CNTL_Type Host_RtcCntl;
+extern UART0_Type    Host_Uart0;
+
+#define RTC_CNTL    (&Host_RtcCntl)
+#define UART0       (&Host_Uart0)
+
+#endif
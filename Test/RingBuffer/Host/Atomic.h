@@ -0,0 +1,71 @@
+/******************************************************************************************
+  Filename    : Atomic.h
+
+  Core        : host (x86-64, AArch64)
+
+  MCU         : none
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Code/Std/Atomic.h on the GCC __atomic builtins for the host test build.
+                Force-included like Platform_Types.h, it takes the same include guard.
+                Each function keeps the ordering of its Xtensa instruction, so that
+                ThreadSanitizer sees the same happens-before edges as the target.
+
+******************************************************************************************/
+
+#ifndef __ATOMIC_H__
+#define __ATOMIC_H__
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include "Platform_Types.h"
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define ATOMIC_COMPILER_BARRIER()   __atomic_signal_fence(__ATOMIC_SEQ_CST)
+#define ATOMIC_BARRIER()            __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+#define ATOMIC_INLINE               static inline __attribute__((always_inline))
+
+//=============================================================================
+// Functions
+//=============================================================================
+
+/* L32AI */
+ATOMIC_INLINE uint32 Atomic_LoadAcquire(const volatile uint32* pValue)
+{
+  return(__atomic_load_n(pValue, __ATOMIC_ACQUIRE));
+}
+
+/* S32RI */
+ATOMIC_INLINE void Atomic_StoreRelease(volatile uint32* pValue, uint32 Value)
+{
+  __atomic_store_n(pValue, Value, __ATOMIC_RELEASE);
+}
+
+/* MEMW + S32C1I + MEMW */
+ATOMIC_INLINE uint32 Atomic_CompareExchange(volatile uint32* pValue, uint32 Expected, uint32 Desired)
+{
+  (void)__atomic_compare_exchange_n(pValue, &Expected, Desired, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+
+  return(Expected);
+}
+
+ATOMIC_INLINE uint32 Atomic_FetchAdd(volatile uint32* pValue, uint32 Add)
+{
+  return(__atomic_fetch_add(pValue, Add, __ATOMIC_SEQ_CST));
+}
+
+ATOMIC_INLINE uint32 Atomic_Exchange(volatile uint32* pValue, uint32 Value)
+{
+  return(__atomic_exchange_n(pValue, Value, __ATOMIC_SEQ_CST));
+}
+
+#endif
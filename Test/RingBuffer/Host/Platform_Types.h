@@ -0,0 +1,48 @@
+/******************************************************************************************
+  Filename    : Platform_Types.h
+
+  Core        : host (x86-64, AArch64)
+
+  MCU         : none
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Platform types of the host test build. Force-included before the sources
+                (-include), it takes the include guard of Code/Std/Platform_Types.h so that
+                uint32 stays 32-bit on a 64-bit host and the section attributes are empty.
+
+******************************************************************************************/
+
+#ifndef __PLATFORM_TYPES_H__
+#define __PLATFORM_TYPES_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint8_t  uint8;
+typedef int8_t   sint8;
+typedef uint16_t uint16;
+typedef int16_t  sint16;
+typedef uint32_t uint32;
+typedef int32_t  sint32;
+typedef uint64_t uint64;
+typedef int64_t  sint64;
+
+#ifndef BOOLEAN_TYPEDEF
+  #define BOOLEAN_TYPEDEF
+  typedef enum
+  {
+    FALSE = 0,
+    TRUE
+  }boolean;
+#endif
+
+#define IRAM_ATTR
+#define COLD_ATTR
+#define DRAM_ATTR
+
+#endif
@@ -0,0 +1,438 @@
+/******************************************************************************************
+  Filename    : RingBufferTest.c
+
+  Core        : host (x86-64, AArch64)
+
+  MCU         : none
+
+  Author      : Chalandi Amine
+
+  Owner       : Chalandi Amine
+
+  Date        : 17.10.2026
+
+  Description : Host test of Code/Std/RingBuffer.c, built with ThreadSanitizer (make run).
+                The cores and the interrupt contexts are played by POSIX threads: several
+                producers in MPSC mode, one producer in SPSC mode, single and batch puts
+                and gets, and free-running indexes started just below the 2^32 wrap.
+
+******************************************************************************************/
+
+//=============================================================================
+// Includes
+//=============================================================================
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "RingBuffer.h"
+
+//=============================================================================
+// Defines
+//=============================================================================
+#define RB_TEST_SIZE            64ul
+#define RB_TEST_MAX_PRODUCERS   8ul
+#define RB_TEST_MAX_BATCH       5ul
+#define RB_TEST_GET_BATCH       16ul
+
+/* elements put by each producer thread */
+#ifndef RB_TEST_COUNT
+  #define RB_TEST_COUNT         100000ul
+#endif
+
+/* start of the indexes for the wrap-around runs (the head crosses 2^32 after 16 puts) */
+#define RB_TEST_WRAP_START      0xFFFFFFF0ul
+
+//=============================================================================
+// Macros
+//=============================================================================
+#define RB_TEST_CHECK(Cond)     RingBufferTest_Check((Cond), #Cond, __LINE__)
+
+//=============================================================================
+// Types
+//=============================================================================
+
+/* three words, so that the element copy is not a power of two of the slot size */
+typedef struct
+{
+  uint32 Producer;
+  uint32 Seq;
+  uint32 Left;      /* elements of the same batch after this one */
+}RingBufferTest_ElemType;
+
+typedef struct
+{
+  RingBuffer_Type* pRb;
+  uint32           Producer;
+}RingBufferTest_ProducerType;
+
+//=============================================================================
+// Globals
+//=============================================================================
+static RingBuffer_Type RingBufferTest_Rb;
+static uint32 RingBufferTest_Storage[RINGBUFFER_STORAGE_WORDS(sizeof(RingBufferTest_ElemType), RB_TEST_SIZE)];
+static uint32 RingBufferTest_Failures;
+
+//=============================================================================
+// Static functions
+//=============================================================================
+static void RingBufferTest_Check(int Cond, const char* pText, int Line);
+static void RingBufferTest_Rebase(RingBuffer_Type* pRb, uint32 Start);
+static void RingBufferTest_Init(void);
+static void RingBufferTest_Single(RingBuffer_ModeType Mode, uint32 Start);
+static void RingBufferTest_Threads(RingBuffer_ModeType Mode, uint32 Producers, uint32 Start);
+static void* RingBufferTest_Producer(void* Arg);
+
+//-----------------------------------------------------------------------------------------
+/// \brief  main function
+///
+/// \param  void
+///
+/// \return 0 if every check passed
+//-----------------------------------------------------------------------------------------
+int main(void)
+{
+  RingBufferTest_Init();
+
+  RingBufferTest_Single(RINGBUFFER_MPSC, 0ul);
+  RingBufferTest_Single(RINGBUFFER_MPSC, RB_TEST_WRAP_START);
+  RingBufferTest_Single(RINGBUFFER_SPSC, RB_TEST_WRAP_START);
+
+  RingBufferTest_Threads(RINGBUFFER_SPSC, 1ul, 0ul);
+  RingBufferTest_Threads(RINGBUFFER_SPSC, 1ul, RB_TEST_WRAP_START);
+  RingBufferTest_Threads(RINGBUFFER_MPSC, 1ul, RB_TEST_WRAP_START);
+  RingBufferTest_Threads(RINGBUFFER_MPSC, 2ul, 0ul);
+  RingBufferTest_Threads(RINGBUFFER_MPSC, 4ul, RB_TEST_WRAP_START);
+  RingBufferTest_Threads(RINGBUFFER_MPSC, RB_TEST_MAX_PRODUCERS, RB_TEST_WRAP_START);
+
+  printf("RINGBUFFER %s (%lu failed checks)\n", (RingBufferTest_Failures == 0ul) ? "OK" : "FAIL",
+                                               (unsigned long)RingBufferTest_Failures);
+
+  return((RingBufferTest_Failures == 0ul) ? 0 : 1);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RingBufferTest_Check function
+///
+/// \param  Cond  : checked condition
+///         pText : its source text
+///         Line  : its line
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void RingBufferTest_Check(int Cond, const char* pText, int Line)
+{
+  if(!Cond)
+  {
+    /* only the first failures, a broken ordering fails on every element */
+    if(RingBufferTest_Failures < 20ul)
+    {
+      printf("  line %d: %s\n", Line, pText);
+    }
+
+    RingBufferTest_Failures++;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RingBufferTest_Rebase function
+///
+/// \descr  Moves an empty ring buffer to the position Start, as if Start elements had
+///         already gone through it (the sequence word of each slot is the position it
+///         accepts a producer for).
+///
+/// \param  pRb   : ring buffer, empty and not shared yet
+///         Start : new head and tail
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void RingBufferTest_Rebase(RingBuffer_Type* pRb, uint32 Start)
+{
+  uint32 Pos;
+
+  pRb->Head = Start;
+  pRb->Tail = Start;
+
+  for(Pos = Start; Pos != (uint32)(Start + pRb->Mask + 1ul); Pos++)
+  {
+    pRb->pSlots[(Pos & pRb->Mask) * (pRb->ElemWords + 1ul)] = Pos;
+  }
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RingBufferTest_Init function
+///
+/// \param  void
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void RingBufferTest_Init(void)
+{
+  printf("init parameters\n");
+
+  RB_TEST_CHECK(RingBuffer_Init(NULL, RingBufferTest_Storage, 8ul, 4ul, RINGBUFFER_MPSC) == FALSE);
+  RB_TEST_CHECK(RingBuffer_Init(&RingBufferTest_Rb, NULL, 8ul, 4ul, RINGBUFFER_MPSC) == FALSE);
+  RB_TEST_CHECK(RingBuffer_Init(&RingBufferTest_Rb, RingBufferTest_Storage, 1ul, 4ul, RINGBUFFER_MPSC) == FALSE);
+  RB_TEST_CHECK(RingBuffer_Init(&RingBufferTest_Rb, RingBufferTest_Storage, 12ul, 4ul, RINGBUFFER_MPSC) == FALSE);
+  RB_TEST_CHECK(RingBuffer_Init(&RingBufferTest_Rb, RingBufferTest_Storage, 8ul, 0ul, RINGBUFFER_MPSC) == FALSE);
+  RB_TEST_CHECK(RingBuffer_Init(&RingBufferTest_Rb, RingBufferTest_Storage, 8ul, 6ul, RINGBUFFER_MPSC) == FALSE);
+  RB_TEST_CHECK(RingBuffer_Init(&RingBufferTest_Rb, RingBufferTest_Storage, 2ul, 4ul, RINGBUFFER_SPSC) == TRUE);
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RingBufferTest_Single function
+///
+/// \descr  One thread: full and empty limits, batches that do not fit (nothing is queued)
+///         and the FIFO order over many laps of an 8 element buffer.
+///
+/// \param  Mode  : RINGBUFFER_MPSC or RINGBUFFER_SPSC
+///         Start : position of the head and the tail before the first put
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void RingBufferTest_Single(RingBuffer_ModeType Mode, uint32 Start)
+{
+  RingBufferTest_ElemType Elems[9];
+  RingBufferTest_ElemType Elem;
+  uint32 Put = 0ul;
+  uint32 Got = 0ul;
+  uint32 Lap;
+  uint32 n;
+  uint32 i;
+
+  printf("single thread %s, start 0x%08lx\n", (Mode == RINGBUFFER_MPSC) ? "MPSC" : "SPSC", (unsigned long)Start);
+
+  RB_TEST_CHECK(RingBuffer_Init(&RingBufferTest_Rb, RingBufferTest_Storage, 8ul, sizeof(RingBufferTest_ElemType), Mode) == TRUE);
+  RingBufferTest_Rebase(&RingBufferTest_Rb, Start);
+
+  RB_TEST_CHECK(RingBuffer_Get(&RingBufferTest_Rb, &Elem) == FALSE);
+
+  /* full after 8 single puts */
+  for(i = 0ul; i < 8ul; i++)
+  {
+    Elem.Seq = Put++;
+    RB_TEST_CHECK(RingBuffer_Put(&RingBufferTest_Rb, &Elem) == TRUE);
+  }
+
+  RB_TEST_CHECK(RingBuffer_Put(&RingBufferTest_Rb, &Elem) == FALSE);
+  RB_TEST_CHECK(RingBuffer_GetCount(&RingBufferTest_Rb) == 8ul);
+
+  for(i = 0ul; i < 8ul; i++)
+  {
+    RB_TEST_CHECK((RingBuffer_Get(&RingBufferTest_Rb, &Elem) == TRUE) && (Elem.Seq == Got++));
+  }
+
+  RB_TEST_CHECK(RingBuffer_Get(&RingBufferTest_Rb, &Elem) == FALSE);
+  RB_TEST_CHECK(RingBuffer_GetCount(&RingBufferTest_Rb) == 0ul);
+
+  /* a batch larger than the buffer, or than its free room, queues nothing */
+  RB_TEST_CHECK(RingBuffer_PutBatch(&RingBufferTest_Rb, Elems, 9ul) == 0ul);
+  RB_TEST_CHECK(RingBuffer_PutBatch(&RingBufferTest_Rb, Elems, 0ul) == 0ul);
+
+  for(i = 0ul; i < 5ul; i++)
+  {
+    Elems[i].Seq = Put++;
+  }
+
+  RB_TEST_CHECK(RingBuffer_PutBatch(&RingBufferTest_Rb, Elems, 5ul) == 5ul);
+  RB_TEST_CHECK(RingBuffer_PutBatch(&RingBufferTest_Rb, Elems, 4ul) == 0ul);
+  RB_TEST_CHECK(RingBuffer_GetCount(&RingBufferTest_Rb) == 5ul);
+
+  n = RingBuffer_GetBatch(&RingBufferTest_Rb, Elems, 9ul);
+  RB_TEST_CHECK(n == 5ul);
+
+  for(i = 0ul; i < n; i++)
+  {
+    RB_TEST_CHECK(Elems[i].Seq == Got++);
+  }
+
+  /* batches of 1 to 8 against gets of 1 to 8, over many laps */
+  for(Lap = 0ul; Lap < 1000ul; Lap++)
+  {
+    n = (Lap % 8ul) + 1ul;
+
+    for(i = 0ul; i < n; i++)
+    {
+      Elems[i].Seq = Put + i;
+    }
+
+    if(RingBuffer_PutBatch(&RingBufferTest_Rb, Elems, n) == n)
+    {
+      Put += n;
+    }
+    else
+    {
+      RB_TEST_CHECK((Put - Got + n) > 8ul);
+    }
+
+    RB_TEST_CHECK(RingBuffer_GetCount(&RingBufferTest_Rb) == (Put - Got));
+
+    n = RingBuffer_GetBatch(&RingBufferTest_Rb, Elems, ((Lap * 3ul) % 8ul) + 1ul);
+
+    for(i = 0ul; i < n; i++)
+    {
+      RB_TEST_CHECK(Elems[i].Seq == Got++);
+    }
+  }
+
+  n = RingBuffer_GetBatch(&RingBufferTest_Rb, Elems, 9ul);
+
+  for(i = 0ul; i < n; i++)
+  {
+    RB_TEST_CHECK(Elems[i].Seq == Got++);
+  }
+
+  RB_TEST_CHECK(Got == Put);
+  RB_TEST_CHECK(RingBufferTest_Rb.Head == (uint32)(Start + Put));
+  RB_TEST_CHECK(RingBufferTest_Rb.Tail == (uint32)(Start + Got));
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RingBufferTest_Threads function
+///
+/// \descr  Producers threads put RB_TEST_COUNT elements each, in batches of 1 to
+///         RB_TEST_MAX_BATCH, while this thread gets them in batches. Each producer's
+///         elements must come out complete and in order, and each batch in one piece.
+///
+/// \param  Mode      : RINGBUFFER_MPSC or RINGBUFFER_SPSC (one producer)
+///         Producers : number of producer threads
+///         Start     : position of the head and the tail before the first put
+///
+/// \return void
+//-----------------------------------------------------------------------------------------
+static void RingBufferTest_Threads(RingBuffer_ModeType Mode, uint32 Producers, uint32 Start)
+{
+  pthread_t Thread[RB_TEST_MAX_PRODUCERS];
+  RingBufferTest_ProducerType Arg[RB_TEST_MAX_PRODUCERS];
+  uint32 Expected[RB_TEST_MAX_PRODUCERS] = { 0ul };
+  RingBufferTest_ElemType Elems[RB_TEST_GET_BATCH];
+  RingBufferTest_ElemType Last = { 0ul, 0ul, 0ul };
+  const uint32 Total = Producers * RB_TEST_COUNT;
+  uint32 Got = 0ul;
+  uint32 n;
+  uint32 i;
+  uint32 p;
+
+  printf("%lu producer thread(s) %s, start 0x%08lx\n", (unsigned long)Producers,
+                                                      (Mode == RINGBUFFER_MPSC) ? "MPSC" : "SPSC",
+                                                      (unsigned long)Start);
+
+  RB_TEST_CHECK(RingBuffer_Init(&RingBufferTest_Rb, RingBufferTest_Storage, RB_TEST_SIZE, sizeof(RingBufferTest_ElemType), Mode) == TRUE);
+  RingBufferTest_Rebase(&RingBufferTest_Rb, Start);
+
+  for(p = 0ul; p < Producers; p++)
+  {
+    Arg[p].pRb      = &RingBufferTest_Rb;
+    Arg[p].Producer = p;
+
+    if(pthread_create(&Thread[p], NULL, RingBufferTest_Producer, &Arg[p]) != 0)
+    {
+      perror("pthread_create");
+      exit(2);
+    }
+  }
+
+  while(Got < Total)
+  {
+    n = RingBuffer_GetBatch(&RingBufferTest_Rb, Elems, RB_TEST_GET_BATCH);
+
+    if(n == 0ul)
+    {
+      (void)sched_yield();
+      continue;
+    }
+
+    for(i = 0ul; i < n; i++)
+    {
+      p = Elems[i].Producer;
+
+      RB_TEST_CHECK(p < Producers);
+      RB_TEST_CHECK(Elems[i].Left < RB_TEST_MAX_BATCH);
+
+      if(p >= Producers)
+      {
+        continue;
+      }
+
+      /* the rest of a batch follows its first element without any other element between */
+      if(Last.Left != 0ul)
+      {
+        RB_TEST_CHECK((p == Last.Producer) && (Elems[i].Left == (Last.Left - 1ul)));
+      }
+
+      RB_TEST_CHECK(Elems[i].Seq == Expected[p]);
+
+      Expected[p] = Elems[i].Seq + 1ul;
+      Last        = Elems[i];
+    }
+
+    Got += n;
+  }
+
+  for(p = 0ul; p < Producers; p++)
+  {
+    (void)pthread_join(Thread[p], NULL);
+
+    RB_TEST_CHECK(Expected[p] == RB_TEST_COUNT);
+  }
+
+  RB_TEST_CHECK(RingBuffer_GetCount(&RingBufferTest_Rb) == 0ul);
+  RB_TEST_CHECK(RingBuffer_Get(&RingBufferTest_Rb, &Elems[0]) == FALSE);
+  RB_TEST_CHECK(RingBufferTest_Rb.Tail == (uint32)(Start + Total));
+}
+
+//-----------------------------------------------------------------------------------------
+/// \brief  RingBufferTest_Producer function
+///
+/// \param  Arg : RingBufferTest_ProducerType of the thread
+///
+/// \return NULL
+//-----------------------------------------------------------------------------------------
+static void* RingBufferTest_Producer(void* Arg)
+{
+  const RingBufferTest_ProducerType* pArg = (const RingBufferTest_ProducerType*)Arg;
+  RingBufferTest_ElemType Elems[RB_TEST_MAX_BATCH];
+  uint32 Seed = pArg->Producer + 1ul;
+  uint32 Seq  = 0ul;
+  uint32 n;
+  uint32 i;
+
+  while(Seq < RB_TEST_COUNT)
+  {
+    /* 1 to RB_TEST_MAX_BATCH elements, single puts through RingBuffer_Put */
+    Seed = (Seed * 1103515245ul) + 12345ul;
+    n    = ((Seed >> 16) % RB_TEST_MAX_BATCH) + 1ul;
+
+    if(n > (RB_TEST_COUNT - Seq))
+    {
+      n = RB_TEST_COUNT - Seq;
+    }
+
+    for(i = 0ul; i < n; i++)
+    {
+      Elems[i].Producer = pArg->Producer;
+      Elems[i].Seq      = Seq + i;
+      Elems[i].Left     = n - i - 1ul;
+    }
+
+    if(n == 1ul)
+    {
+      while(RingBuffer_Put(pArg->pRb, &Elems[0]) == FALSE)
+      {
+        (void)sched_yield();
+      }
+    }
+    else
+    {
+      while(RingBuffer_PutBatch(pArg->pRb, Elems, n) != n)
+      {
+        (void)sched_yield();
+      }
+    }
+
+    Seq += n;
+  }
+
+  return(NULL);
+}
@@ -0,0 +1,76 @@
+import argparse
+import sys
+
+# Parses the boot profile printed by BootProfile_Print() (Code/Startup/BootProfile.c)
+#
+#   BOOTPROF BEGIN <systimer MHz>
+#   BOOTPROF <phase> <name> <systimer ticks since reset> <ccount> <phase duration us>
+#   BOOTPROF END <boot time us> <budget us> <OK|OVER>
+
+def parse_boot_profile(lines):
+    records = []
+    current = None
+
+    for line in lines:
+        fields = line.strip().split()
+
+        if len(fields) < 2 or fields[0] != "BOOTPROF":
+            continue
+
+        if fields[1] == "BEGIN":
+            current = {'mhz': int(fields[2]), 'phases': []}
+        elif fields[1] == "END" and current is not None:
+            current['total_us'] = int(fields[2])
+            current['budget_us'] = int(fields[3])
+            records.append(current)
+            current = None
+        elif current is not None and len(fields) == 6:
+            current['phases'].append({'name': fields[2],
+                                      'ticks': int(fields[3]),
+                                      'ccount': int(fields[4])})
+
+    return records
+
+def print_boot_profile(record):
+    print(f"{'Phase':<16} {'End (us)':>10} {'Duration (us)':>14} {'Cycles':>12}")
+
+    prev_ticks = 0
+    prev_ccount = None
+
+    for phase in record['phases']:
+        end_us = phase['ticks'] / record['mhz']
+        duration_us = (phase['ticks'] - prev_ticks) / record['mhz']
+        # the cycle counter is only meaningful as a difference between two phases
+        cycles = "-" if prev_ccount is None else str((phase['ccount'] - prev_ccount) & 0xFFFFFFFF)
+        print(f"{phase['name']:<16} {end_us:>10.1f} {duration_us:>14.1f} {cycles:>12}")
+        prev_ticks = phase['ticks']
+        prev_ccount = phase['ccount']
+
+    print(f"Boot time: {record['total_us']} us")
+
+# Main execution starts here
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Parse the ESP32-S3 boot profile from a serial log")
+    parser.add_argument("log", nargs="?", help="serial log file (stdin if omitted)")
+    parser.add_argument("--budget-us", type=int, default=0, help="fail if the boot time exceeds this budget")
+    args = parser.parse_args()
+
+    if args.log:
+        with open(args.log, 'r', errors='replace') as f:
+            records = parse_boot_profile(f)
+    else:
+        records = parse_boot_profile(sys.stdin)
+
+    if not records:
+        print("Error: no boot profile found")
+        sys.exit(1)
+
+    # the last boot of the log is the relevant one
+    record = records[-1]
+    print_boot_profile(record)
+
+    budget_us = args.budget_us if args.budget_us else record['budget_us']
+
+    if budget_us and (record['total_us'] == 0 or record['total_us'] > budget_us):
+        print(f"Error: boot time budget exceeded ({record['total_us']} us > {budget_us} us)")
+        sys.exit(1)
@@ -0,0 +1,135 @@
+import argparse
+import struct
+import subprocess
+import sys
+import zlib
+
+# Decodes the crash records sent by Crash_ReportPrevious() (Code/Startup/Crash.c) in a raw serial capture
+#
+#   "CRSH" <record length, 16-bit little endian> <Crash_RecordType, little endian words>
+
+FRAME_SYNC = b"CRSH"
+
+STACK_WORDS = 64
+RECORD_FORMAT = "<11I7I6I16II%dII" % STACK_WORDS
+RECORD_SIZE = struct.calcsize(RECORD_FORMAT)
+
+REASONS = {1: "kernel exception", 2: "user exception", 3: "double exception", 4: "invalid vector", 5: "panic"}
+PANICS = {1: "stack overflow", 2: "unhandled interrupt"}
+
+EXCCAUSES = {0: "IllegalInstruction", 1: "Syscall", 2: "InstructionFetchError", 3: "LoadStoreError",
+             4: "Level1Interrupt", 5: "Alloca", 6: "IntegerDivideByZero", 8: "Privileged",
+             9: "LoadStoreAlignment", 12: "InstrPIFDataError", 13: "LoadStorePIFDataError",
+             14: "InstrPIFAddrError", 15: "LoadStorePIFAddrError", 16: "InstTLBMiss",
+             17: "InstTLBMultiHit", 18: "InstFetchPrivilege", 20: "InstFetchProhibited",
+             24: "LoadStoreTLBMiss", 25: "LoadStoreTLBMultiHit", 26: "LoadStorePrivilege",
+             28: "LoadProhibited", 29: "StoreProhibited", 32: "Coprocessor0Disabled"}
+
+# executable address ranges (IRAM, flash XIP, RTC fast memory)
+CODE_RANGES = [(0x40370000, 0x403E0000), (0x42000000, 0x44000000), (0x600FE000, 0x60100000)]
+
+def find_records(data):
+    records = []
+    pos = data.find(FRAME_SYNC)
+
+    while pos >= 0:
+        start = pos + len(FRAME_SYNC) + 2
+        length = struct.unpack_from("<H", data, pos + len(FRAME_SYNC))[0] if start <= len(data) else 0
+
+        if length == RECORD_SIZE and start + length <= len(data):
+            raw = data[start:start + length]
+            fields = struct.unpack(RECORD_FORMAT, raw)
+            crc_ok = (zlib.crc32(raw[:-4]) & 0xFFFFFFFF) == fields[-1]
+            records.append((fields, crc_ok))
+            pos = data.find(FRAME_SYNC, start + length)
+        else:
+            pos = data.find(FRAME_SYNC, pos + 1)
+
+    return records
+
+def unpack_record(fields):
+    names = ["magic", "core", "reason", "exccause", "excvaddr", "ps", "sar", "lbeg", "lend", "lcount", "depc"]
+    record = dict(zip(names, fields[0:11]))
+    record['epc'] = list(fields[11:18])
+    record['eps'] = list(fields[18:24])
+    record['a'] = list(fields[24:40])
+    record['stack'] = list(fields[41:41 + min(fields[40], STACK_WORDS)])
+    return record
+
+def is_code(addr):
+    return any(lo <= addr < hi for lo, hi in CODE_RANGES)
+
+def symbolize(addresses, elf, addr2line):
+    if not elf or not addresses:
+        return {}
+
+    addresses = sorted(set(addresses))
+
+    try:
+        out = subprocess.run([addr2line, "-e", elf, "-f", "-C", "-p"] + [hex(a) for a in addresses],
+                             capture_output=True, text=True, check=True).stdout.splitlines()
+    except (OSError, subprocess.CalledProcessError) as e:
+        print(f"Warning: {addr2line} failed ({e}), addresses are not symbolized")
+        return {}
+
+    return dict(zip(addresses, out))
+
+def print_record(record, crc_ok, elf, addr2line):
+    # the call0 ABI keeps the return address in a0, the stack words are only candidates
+    candidates = [pc for pc in record['epc'] if is_code(pc)] + [record['a'][0], record['depc']]
+    candidates += [w for w in record['stack'] if is_code(w)]
+    symbols = symbolize([a for a in candidates if is_code(a)], elf, addr2line)
+
+    def sym(addr):
+        return f"  {symbols[addr]}" if addr in symbols else ""
+
+    reason = REASONS.get(record['reason'], "unknown")
+    if record['reason'] == 5:
+        reason += f" ({PANICS.get(record['a'][2], 'code %d' % record['a'][2])}, arg 0x{record['a'][3]:08X})"
+
+    print(f"Crash on core {record['core']}: {reason}{'' if crc_ok else '  [CRC ERROR]'}")
+    print(f"  EXCCAUSE  {record['exccause']:>10} {EXCCAUSES.get(record['exccause'], '')}")
+    print(f"  EXCVADDR  0x{record['excvaddr']:08X}")
+    print(f"  PS        0x{record['ps']:08X}   SAR 0x{record['sar']:08X}")
+    print(f"  LBEG      0x{record['lbeg']:08X}   LEND 0x{record['lend']:08X}   LCOUNT 0x{record['lcount']:08X}")
+    print(f"  DEPC      0x{record['depc']:08X}{sym(record['depc'])}")
+
+    for level, pc in enumerate(record['epc'], start=1):
+        print(f"  EPC{level}      0x{pc:08X}{sym(pc)}")
+
+    for level, ps in enumerate(record['eps'], start=2):
+        print(f"  EPS{level}      0x{ps:08X}")
+
+    for reg, value in enumerate(record['a']):
+        print(f"  A{reg:<2}       0x{value:08X}{sym(value) if reg == 0 else ''}")
+
+    sp = record['a'][1]
+    print(f"  Stack ({len(record['stack'])} words from SP):")
+
+    for i, word in enumerate(record['stack']):
+        print(f"    0x{sp + 4 * i:08X}: 0x{word:08X}{sym(word) if is_code(word) else ''}")
+
+# Main execution starts here
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Decode the ESP32-S3 crash records from a raw serial capture")
+    parser.add_argument("log", nargs="?", help="raw (binary) serial capture (stdin if omitted)")
+    parser.add_argument("--elf", help="ELF file of the crashed firmware, used to symbolize the addresses")
+    parser.add_argument("--addr2line", default="xtensa-esp32s3-elf-addr2line", help="addr2line of the toolchain")
+    args = parser.parse_args()
+
+    if args.log:
+        with open(args.log, 'rb') as f:
+            data = f.read()
+    else:
+        data = sys.stdin.buffer.read()
+
+    records = find_records(data)
+
+    if not records:
+        print("Error: no crash record found")
+        sys.exit(1)
+
+    for fields, crc_ok in records:
+        print_record(unpack_record(fields), crc_ok, args.elf, args.addr2line)
+
+    sys.exit(0 if all(crc_ok for _, crc_ok in records) else 1)
@@ -0,0 +1,85 @@
+import argparse
+import sys
+
+# Parses the interrupt latency histograms printed by IrqLatency_Print() (Code/Startup/IrqLatency.c)
+#
+#   IRQLAT <core> <level> <ENTRY|HANDLER> <count> <min> <max> <avg> <bin0> ... <bin15>
+#
+# bin n counts the latencies of n significant bits (bin 0: 0 cycles, the last bin is open-ended)
+
+NUM_BINS = 16
+
+def parse_irq_latency(lines):
+    hists = {}
+
+    for line in lines:
+        fields = line.strip().split()
+
+        if len(fields) != 8 + NUM_BINS or fields[0] != "IRQLAT":
+            continue
+
+        key = (int(fields[1]), int(fields[2]), fields[3])
+        # a later dump of the same log replaces the earlier one
+        hists[key] = {'count': int(fields[4]),
+                      'min': int(fields[5]),
+                      'max': int(fields[6]),
+                      'avg': int(fields[7]),
+                      'bins': [int(x) for x in fields[8:]]}
+
+    return hists
+
+def bin_range(n):
+    if n == 0:
+        return "0"
+    if n == NUM_BINS - 1:
+        return f">={1 << (n - 1)}"
+    return f"{1 << (n - 1)}-{(1 << n) - 1}"
+
+def print_irq_latency(hists, baseline):
+    print(f"{'Core':>4} {'Level':>5} {'Kind':<8} {'Count':>8} {'Min':>6} {'Avg':>6} {'Max':>6} {'Jitter':>7} {'Max delta':>10}")
+
+    for key in sorted(hists):
+        h = hists[key]
+        delta = ""
+        if baseline is not None and key in baseline:
+            delta = f"{h['max'] - baseline[key]['max']:+d}"
+        print(f"{key[0]:>4} {key[1]:>5} {key[2]:<8} {h['count']:>8} {h['min']:>6} {h['avg']:>6} {h['max']:>6} {h['max'] - h['min']:>7} {delta:>10}")
+
+    for key in sorted(hists):
+        h = hists[key]
+        print(f"\nCore {key[0]} level {key[1]} {key[2]} (cycles):")
+        peak = max(h['bins']) or 1
+        for n, count in enumerate(h['bins']):
+            if count:
+                print(f"  {bin_range(n):>12} {count:>8} {'#' * max(1, (40 * count) // peak)}")
+
+def read_log(path):
+    if path:
+        with open(path, 'r', errors='replace') as f:
+            return parse_irq_latency(f)
+    return parse_irq_latency(sys.stdin)
+
+# Main execution starts here
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Parse the ESP32-S3 interrupt latency histograms from a serial log")
+    parser.add_argument("log", nargs="?", help="serial log file (stdin if omitted)")
+    parser.add_argument("--baseline", help="serial log of the reference firmware, the worst-case change is shown")
+    parser.add_argument("--max-cycles", type=int, default=0, help="fail if a worst-case handler latency exceeds this limit")
+    args = parser.parse_args()
+
+    hists = read_log(args.log)
+
+    if not hists:
+        print("Error: no interrupt latency histogram found (build with IRQ_LATENCY=1)")
+        sys.exit(1)
+
+    baseline = read_log(args.baseline) if args.baseline else None
+
+    print_irq_latency(hists, baseline)
+
+    if args.max_cycles:
+        over = [key for key, h in hists.items() if key[2] == "HANDLER" and h['max'] > args.max_cycles]
+        for key in sorted(over):
+            print(f"Error: core {key[0]} level {key[1]} worst-case latency {hists[key]['max']} cycles > {args.max_cycles}")
+        if over:
+            sys.exit(1)